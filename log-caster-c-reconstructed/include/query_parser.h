@@ -3,6 +3,7 @@
 #define QUERY_PARSER_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <time.h>
 #include <regex.h>
 
@@ -17,6 +18,7 @@ typedef enum {
 // 파싱된 쿼리 정보를 담는 구조체
 typedef struct {
     char* keywords[10];          // 다중 키워드 배열
+    size_t keyword_lengths[10];  // 키워드 길이 (검색마다 strlen하지 않도록 파싱 때 저장)
     int keyword_count;           // 키워드 개수
     char* regex_pattern;         // 정규식 패턴 문자열
     regex_t* compiled_regex;     // 컴파일된 정규식 객체
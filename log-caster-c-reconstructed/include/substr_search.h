@@ -0,0 +1,16 @@
+// [SEQUENCE: C-MVP5-15]
+#ifndef SUBSTR_SEARCH_H
+#define SUBSTR_SEARCH_H
+
+#include <stddef.h>
+
+// [SEQUENCE: C-MVP5-16]
+// 키워드 검색용 부분 문자열 검색 (C++ 버전 SubstringSearch와 같은 방식).
+// 찾을 문자열의 첫 바이트와 끝 바이트를 벡터 레지스터에 채워 두고 본문을 32/16바이트씩 비교해,
+// 두 바이트가 모두 맞는 자리만 memcmp로 확인. 커널은 처음 호출 때 CPU 기능을 보고 고름 (AVX2 > SSE2 > 스칼라)
+const char* substr_search(const char* haystack, size_t haystack_len, const char* needle, size_t needle_len);
+
+// 선택된 커널 이름 ("avx2", "sse2", "scalar")
+const char* substr_search_kernel_name(void);
+
+#endif // SUBSTR_SEARCH_H
@@ -1,5 +1,6 @@
 // [SEQUENCE: MVP2-24]
 #include "log_buffer.h"
+#include "substr_search.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -67,6 +68,9 @@ int log_buffer_push(log_buffer_t* buffer, const char* message) {
 // 키워드를 포함하는 로그 검색 (MVP2 기본 버전)
 int log_buffer_search(log_buffer_t* buffer, const char* keyword, char*** results, int* count) {
     if (!buffer || !keyword || !results || !count) return -1;
+    // [SEQUENCE: C-MVP5-21]
+    // 키워드 검사는 substr_search 커널 사용
+    size_t keyword_len = strlen(keyword);
     
     pthread_mutex_lock(&buffer->mutex);
     
@@ -74,7 +78,8 @@ int log_buffer_search(log_buffer_t* buffer, const char* keyword, char*** results
     *count = 0;
     for (size_t i = 0; i < buffer->size; i++) {
         size_t idx = (buffer->tail + i) % buffer->capacity;
-        if (strstr(buffer->entries[idx]->message, keyword)) {
+        const char* message = buffer->entries[idx]->message;
+        if (substr_search(message, strlen(message), keyword, keyword_len)) {
             (*count)++;
         }
     }
@@ -96,7 +101,8 @@ int log_buffer_search(log_buffer_t* buffer, const char* keyword, char*** results
     int result_idx = 0;
     for (size_t i = 0; i < buffer->size && result_idx < *count; i++) {
         size_t idx = (buffer->tail + i) % buffer->capacity;
-        if (strstr(buffer->entries[idx]->message, keyword)) {
+        const char* message = buffer->entries[idx]->message;
+        if (substr_search(message, strlen(message), keyword, keyword_len)) {
             (*results)[result_idx++] = strdup(buffer->entries[idx]->message);
         }
     }
@@ -3,6 +3,7 @@
 #include "server.h"
 // [SEQUENCE: C-MVP3-19]
 #include "query_parser.h"
+#include "substr_search.h"
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -62,8 +63,11 @@ static void process_query_command(log_server_t* server, int client_fd, const cha
     } else if (strcmp(command, "STATS") == 0) {
         unsigned long total, dropped;
         log_buffer_get_stats(server->log_buffer, &total, &dropped);
-        snprintf(response, sizeof(response), "STATS: Total=%lu, Dropped=%lu, Current=%zu, Clients=%d\n",
-                 total, dropped, log_buffer_size(server->log_buffer), server->client_count);
+        // [SEQUENCE: C-MVP5-22]
+        // 선택된 부분 문자열 커널도 함께 보고
+        snprintf(response, sizeof(response), "STATS: Total=%lu, Dropped=%lu, Current=%zu, Clients=%d, SearchKernel=%s\n",
+                 total, dropped, log_buffer_size(server->log_buffer), server->client_count,
+                 substr_search_kernel_name());
         send(client_fd, response, strlen(response), 0);
     } else if (strcmp(command, "COUNT") == 0) {
         snprintf(response, sizeof(response), "COUNT: %zu\n", log_buffer_size(server->log_buffer));
@@ -1,5 +1,6 @@
 // [SEQUENCE: MVP3-8]
 #include "query_parser.h"
+#include "substr_search.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -64,6 +65,7 @@ int query_parser_parse(parsed_query_t* query, const char* query_string) {
                 char* saveptr2;
                 char* keyword_token = strtok_r(value_copy, ",", &saveptr2);
                 while (keyword_token && query->keyword_count < 10) {
+                    query->keyword_lengths[query->keyword_count] = strlen(keyword_token);
                     query->keywords[query->keyword_count++] = strdup(keyword_token);
                     keyword_token = strtok_r(NULL, ",", &saveptr2);
                 }
@@ -119,10 +121,13 @@ bool query_matches_log(const parsed_query_t* query, const char* log_message, tim
     }
 
     // 키워드 필터 검사
+    // [SEQUENCE: C-MVP5-20]
+    // 메시지 길이는 한 번만 재고 키워드마다 substr_search 커널로 검사
     if (query->keyword_count > 0) {
         bool match = (query->op == OP_AND);
+        size_t message_len = strlen(log_message);
         for (int i = 0; i < query->keyword_count; i++) {
-            bool found = (strstr(log_message, query->keywords[i]) != NULL);
+            bool found = (substr_search(log_message, message_len, query->keywords[i], query->keyword_lengths[i]) != NULL);
             if (query->op == OP_AND && !found) return false;
             if (query->op == OP_OR && found) {
                 match = true;
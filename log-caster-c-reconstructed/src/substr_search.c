@@ -0,0 +1,119 @@
+// [SEQUENCE: C-MVP5-17]
+#include "substr_search.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SUBSTR_SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+typedef const char* (*substr_kernel_t)(const char*, size_t, const char*, size_t);
+
+// 벡터 블록 하나보다 짧은 본문과 벡터 커널이 없는 환경: memchr로 첫 바이트를 찾고 나머지 비교
+static const char* substr_search_scalar(const char* haystack, size_t haystack_len, const char* needle, size_t needle_len) {
+    const char* end = haystack + haystack_len - needle_len + 1;
+    const char* at = haystack;
+    while (at < end && (at = memchr(at, needle[0], (size_t)(end - at))) != NULL) {
+        if (memcmp(at + 1, needle + 1, needle_len - 1) == 0) return at;
+        at++;
+    }
+    return NULL;
+}
+
+#ifdef SUBSTR_SEARCH_X86
+// [SEQUENCE: C-MVP5-18]
+// 블록의 첫/끝 바이트가 모두 맞는 자리를 낮은 비트부터 확인 (가운데 needle_len - 2 바이트만 비교)
+static inline const char* substr_verify(uint32_t mask, const char* block, const char* needle, size_t needle_len) {
+    while (mask) {
+        const char* at = block + __builtin_ctz(mask);
+        if (needle_len <= 2 || memcmp(at + 1, needle + 1, needle_len - 2) == 0) return at;
+        mask &= mask - 1;
+    }
+    return NULL;
+}
+
+__attribute__((target("sse2")))
+static inline uint32_t substr_block_sse2(const char* at, size_t needle_len, __m128i first, __m128i last) {
+    __m128i head = _mm_loadu_si128((const __m128i*)at);
+    __m128i tail = _mm_loadu_si128((const __m128i*)(at + needle_len - 1));
+    return (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last)));
+}
+
+__attribute__((target("avx2")))
+static inline uint32_t substr_block_avx2(const char* at, size_t needle_len, __m256i first, __m256i last) {
+    __m256i head = _mm256_loadu_si256((const __m256i*)at);
+    __m256i tail = _mm256_loadu_si256((const __m256i*)(at + needle_len - 1));
+    return (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(head, first), _mm256_cmpeq_epi8(tail, last)));
+}
+
+// 마지막 블록은 본문 끝에 맞춰 겹쳐 읽고 이미 본 자리의 비트를 지움. 블록보다 짧은 본문은 더 작은 커널로 넘김
+__attribute__((target("sse2")))
+static const char* substr_search_sse2(const char* haystack, size_t haystack_len, const char* needle, size_t needle_len) {
+    const size_t width = 16;
+    if (haystack_len < needle_len - 1 + width) return substr_search_scalar(haystack, haystack_len, needle, needle_len);
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[needle_len - 1]);
+    size_t end = haystack_len - needle_len + 1;
+    size_t i = 0;
+    for (; i + width <= end; i += width) {
+        const char* at = substr_verify(substr_block_sse2(haystack + i, needle_len, first, last), haystack + i, needle, needle_len);
+        if (at) return at;
+    }
+    if (i == end) return NULL;
+    size_t from = end - width;
+    uint32_t mask = substr_block_sse2(haystack + from, needle_len, first, last) & (~0u << (i - from));
+    return substr_verify(mask, haystack + from, needle, needle_len);
+}
+
+__attribute__((target("avx2")))
+static const char* substr_search_avx2(const char* haystack, size_t haystack_len, const char* needle, size_t needle_len) {
+    const size_t width = 32;
+    if (haystack_len < needle_len - 1 + width) return substr_search_sse2(haystack, haystack_len, needle, needle_len);
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[needle_len - 1]);
+    size_t end = haystack_len - needle_len + 1;
+    size_t i = 0;
+    for (; i + width <= end; i += width) {
+        const char* at = substr_verify(substr_block_avx2(haystack + i, needle_len, first, last), haystack + i, needle, needle_len);
+        if (at) return at;
+    }
+    if (i == end) return NULL;
+    size_t from = end - width;
+    uint32_t mask = substr_block_avx2(haystack + from, needle_len, first, last) & (~0u << (i - from));
+    return substr_verify(mask, haystack + from, needle, needle_len);
+}
+#endif
+
+// [SEQUENCE: C-MVP5-19]
+// 커널 선택은 pthread_once로 한 번만
+static pthread_once_t substr_once = PTHREAD_ONCE_INIT;
+static substr_kernel_t substr_kernel = substr_search_scalar;
+static const char* substr_kernel_name = "scalar";
+
+static void substr_select_kernel(void) {
+#ifdef SUBSTR_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        substr_kernel = substr_search_avx2;
+        substr_kernel_name = "avx2";
+    } else if (__builtin_cpu_supports("sse2")) {
+        substr_kernel = substr_search_sse2;
+        substr_kernel_name = "sse2";
+    }
+#endif
+}
+
+const char* substr_search(const char* haystack, size_t haystack_len, const char* needle, size_t needle_len) {
+    if (needle_len == 0) return haystack;
+    if (needle_len > haystack_len) return NULL;
+    if (needle_len == 1) return memchr(haystack, needle[0], haystack_len);
+    pthread_once(&substr_once, substr_select_kernel);
+    return substr_kernel(haystack, haystack_len, needle, needle_len);
+}
+
+const char* substr_search_kernel_name(void) {
+    pthread_once(&substr_once, substr_select_kernel);
+    return substr_kernel_name;
+}
@@ -0,0 +1,99 @@
+// [SEQUENCE: C-MVP5-23]
+// substr_search 커널 차등 테스트 (make test). 커널 함수가 static이라 소스를 직접 포함하고,
+// 스칼라/SSE2/AVX2 커널과 substr_search를 memmem 결과와 비교한다.
+// 본문은 정확한 크기로 malloc해 ASan 빌드에서 블록 경계 밖 읽기가 드러나게 한다.
+#include "../src/substr_search.c"
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    const char* name;
+    substr_kernel_t kernel;
+} named_kernel_t;
+
+static named_kernel_t kernels[3];
+static int kernel_count = 0;
+static unsigned long failures = 0;
+static unsigned long cases = 0;
+static unsigned int seed = 2024;
+
+static unsigned int next_random(void) {
+    seed = seed * 1103515245u + 12345u;
+    return (seed >> 16) & 0x7fff;
+}
+
+static void report(const char* kernel, size_t size, const char* needle, size_t needle_len, long expected, long got) {
+    if (++failures > 10) return;
+    fprintf(stderr, "FAIL %s: size=%zu needle=\"%.*s\" expected=%ld got=%ld\n",
+            kernel, size, (int)needle_len, needle, expected, got);
+}
+
+static long offset_of(const char* at, const char* base) {
+    return at ? (long)(at - base) : -1;
+}
+
+// 본문을 정확한 크기의 버퍼로 옮겨 모든 커널과 substr_search를 memmem 결과와 비교
+static void check(const char* haystack, size_t size, const char* needle, size_t needle_len) {
+    cases++;
+    char* exact = malloc(size + 1);
+    memcpy(exact, haystack, size);
+    long expected = offset_of(memmem(exact, size, needle, needle_len), exact);
+
+    long got = offset_of(substr_search(exact, size, needle, needle_len), exact);
+    if (got != expected) report("substr_search", size, needle, needle_len, expected, got);
+    if (needle_len > 0 && needle_len <= size) {
+        for (int k = 0; k < kernel_count; k++) {
+            got = offset_of(kernels[k].kernel(exact, size, needle, needle_len), exact);
+            if (got != expected) report(kernels[k].name, size, needle, needle_len, expected, got);
+        }
+    }
+    free(exact);
+}
+
+// needle 길이 1..64, 본문 길이는 needle 길이부터 블록 두 개 남짓까지. 잡음은 needle의 첫/끝/가운데 바이트로
+// 채워 첫/끝만 맞는 후보 자리를 많이 만들고, needle을 맨 앞, 맨 끝, 겹쳐 읽는 마지막 블록에 걸치는 자리에 심음
+static void test_find(void) {
+    char needle[64];
+    char base[160];
+    char planted[160];
+    for (size_t n = 1; n <= 64; n++) {
+        for (size_t j = 0; j < n; j++) needle[j] = (char)('a' + next_random() % 3);
+        const char pool[4] = {needle[0], needle[n - 1], needle[n / 2], 'x'};
+        for (size_t size = n; size <= n + 80; size++) {
+            for (size_t j = 0; j < size; j++) base[j] = pool[next_random() % 4];
+            check(base, size, needle, n);
+
+            size_t last = size - n;
+            size_t from = last > 40 ? last - 40 : 0;
+            for (size_t at = from; at <= last; at++) {
+                memcpy(planted, base, size);
+                memcpy(planted + at, needle, n);
+                check(planted, size, needle, n);
+            }
+            if (from > 0) {
+                memcpy(planted, base, size);
+                memcpy(planted, needle, n);
+                check(planted, size, needle, n);
+            }
+        }
+    }
+    // 경계 조건: 빈 needle, 빈 본문, 본문보다 긴 needle
+    check("", 0, "", 0);
+    check("abc", 3, "", 0);
+    check("", 0, "a", 1);
+    check("ab", 2, "abc", 3);
+}
+
+int main(void) {
+    kernels[kernel_count++] = (named_kernel_t){"scalar", substr_search_scalar};
+#ifdef SUBSTR_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2")) kernels[kernel_count++] = (named_kernel_t){"sse2", substr_search_sse2};
+    if (__builtin_cpu_supports("avx2")) kernels[kernel_count++] = (named_kernel_t){"avx2", substr_search_avx2};
+#endif
+    test_find();
+    printf("kernel=%s cases=%lu failures=%lu\n", substr_search_kernel_name(), cases, failures);
+    if (failures != 0) return 1;
+    printf("All substr_search tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,59 @@
+// [SEQUENCE: CPP-MVP7-141]
+#ifndef BINARYFRAMER_H
+#define BINARYFRAMER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "LogBuffer.h"
+
+// [SEQUENCE: CPP-MVP7-142]
+// 길이 접두 바이너리 수집 프로토콜 디코더 (연결당 하나, 모든 정수는 네트워크 바이트 순서).
+//
+//   frame  := u32 length | body[length]
+//   DEFINE := u8 type=1 | u16 id | u16 len | bytes[len]
+//             (source/category/메타데이터 키로 쓸 문자열을 id(1~MAX_INTERNED)에 등록)
+//   LOG    := u8 type=2 | u8 level | u8 metaCount | u8 reserved
+//             | u16 sourceId | u16 categoryId | u64 timestampMicros
+//             | metaCount * (u16 keyId | u16 valueLen | bytes[valueLen]) | payload
+//
+// sourceId 0은 연결의 기본 source, categoryId 0은 분류 없음, timestamp 0은 수신 시각을 뜻한다.
+// 프레임은 수신 버퍼에서 바로 해석하며, 읽기 경계에 걸친 프레임만 내부 버퍼에 모은다.
+class BinaryFramer {
+public:
+    static constexpr size_t HEADER_SIZE = 4;
+    static constexpr size_t LOG_HEADER_SIZE = 16;
+    static constexpr size_t MAX_FRAME_SIZE = 64 * 1024;
+    static constexpr uint16_t MAX_INTERNED = 4096;
+
+    enum FrameType : uint8_t {
+        FRAME_DEFINE = 1,
+        FRAME_LOG = 2
+    };
+
+    enum Level : uint8_t {
+        LEVEL_DEBUG = 0,
+        LEVEL_INFO = 1,
+        LEVEL_WARN = 2,
+        LEVEL_ERROR = 3
+    };
+
+    BinaryFramer(size_t maxMessageLength, std::string defaultSource);
+
+    // 완성된 LOG 프레임을 out에 추가. 잘못된 프레임이면 false (호출자가 연결을 끊음)
+    bool feed(const char* data, size_t len, std::vector<LogEntry>& out);
+
+    static const std::string& levelName(uint8_t level);
+
+private:
+    bool decode(const uint8_t* body, size_t len, std::vector<LogEntry>& out);
+    const std::string* lookup(uint16_t id) const;
+
+    size_t maxMessageLength_;
+    std::string defaultSource_;
+    std::vector<uint8_t> partial_;
+    std::vector<std::string> strings_;
+};
+
+#endif // BINARYFRAMER_H
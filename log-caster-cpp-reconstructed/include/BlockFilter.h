@@ -0,0 +1,69 @@
+// [SEQUENCE: CPP-MVP7-322]
+#ifndef BLOCKFILTER_H
+#define BLOCKFILTER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// [SEQUENCE: CPP-MVP7-323]
+// 역색인 대신 쓰는 가벼운 색인: 항목 순번 BLOCK_ENTRIES개를 한 블록으로 묶고, 블록마다 메시지 3글자 키의
+// 블룸 필터와 최소/최대 타임스탬프만 둔다. 키워드/정규식 고정 문자열의 키가 하나라도 빠진 블록과
+// 시간 범위 밖의 블록을 건너뛰며, 블룸 필터 특성상 후보는 실제보다 넓을 수만 있다 (본문 검사는 호출자가 한다).
+// 키워드는 부분 문자열 조건이라 토큰이 아니라 TrigramIndex와 같은 3글자 키를 넣는다.
+// 제거된 항목은 블록의 살아 있는 항목 수만 줄이고, 후보로 펼쳐진 제거 항목은 링이 위치를 찾지 못해 걸러진다.
+// 블록은 항목당 FILTER_BITS / BLOCK_ENTRIES 비트로 크기가 고정되어, 메모리가 어휘나 항목 내용에 따라 늘지 않는다.
+// 쓰기(add/remove)는 샤드 락 아래에서 호출되고, 검색은 공유 락으로 후보만 계산한다.
+class BlockFilter {
+public:
+    using Time = int64_t;
+    static constexpr size_t BLOCK_ENTRIES = 1024;
+    static constexpr size_t FILTER_BITS = 32 * 1024;
+    // 키마다 세우는 비트 수
+    static constexpr int PROBES = 3;
+
+    void add(uint64_t sequence, Time timestamp, std::string_view message);
+    // 항목이 링에서 밀려나거나 중간에서 제거됨. 살아 있는 항목이 없는 블록은 바로 버림
+    void remove(uint64_t sequence);
+
+    // [SEQUENCE: CPP-MVP7-324]
+    // required 문자열을 모두(all) 또는 하나라도 품을 수 있고 [timeFrom, timeTo]와 겹치는 블록의 항목 순번을
+    // 오름차순으로 out에 채움. 세 글자보다 짧은 문자열처럼 좁힐 수 없거나 후보가 limit를 넘으면 false (전체 훑기)
+    bool candidates(const std::vector<std::string>& required, bool all, Time timeFrom, Time timeTo,
+                    size_t limit, std::vector<uint64_t>& out) const;
+
+    // 락 없이 읽는 수치 (블록 수, 근사 바이트)
+    size_t blockCount() const { return blockCount_.load(std::memory_order_relaxed); }
+    size_t bytes() const { return blockCount() * sizeof(Block); }
+
+private:
+    struct Block {
+        uint64_t number;
+        uint32_t live = 0;
+        Time minTime = std::numeric_limits<Time>::max();
+        Time maxTime = std::numeric_limits<Time>::min();
+        std::array<uint64_t, FILTER_BITS / 64> bits{};
+    };
+
+    // 3글자 키의 비트 위치들을 한 번의 곱셈 해시에서 잘라 씀
+    static uint64_t hashOf(uint32_t key) { return (key + 1) * 0x9E3779B97F4A7C15ull; }
+    static size_t bitOf(uint64_t hash, int probe) { return (hash >> (16 * probe)) & (FILTER_BITS - 1); }
+    static bool contains(const Block& block, const std::vector<uint64_t>& hashes);
+    // literal의 3글자 키 해시 (세 글자보다 짧으면 빈 목록)
+    static std::vector<uint64_t> hashesOf(std::string_view literal);
+
+    mutable std::shared_mutex mutex_;
+    std::deque<Block> blocks_;
+    uint64_t latest_ = 0;
+
+    std::atomic<size_t> blockCount_{0};
+};
+
+#endif // BLOCKFILTER_H
@@ -0,0 +1,73 @@
+// [SEQUENCE: CPP-MVP7-108]
+#ifndef DATAGRAMRECEIVER_H
+#define DATAGRAMRECEIVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include "LogBuffer.h"
+
+class LogServer;
+
+// [SEQUENCE: CPP-MVP7-109]
+// 데이터그램 수신기. 전용 스레드가 recvmmsg로 데이터그램을 묶어 받고,
+// 한 번에 받은 묶음 전체를 LogServer에 하나의 배치로 넘긴다.
+// [SEQUENCE: CPP-MVP7-127]
+// UDP syslog와 AF_UNIX 데이터그램 소켓이 공유하며, AF_UNIX는 SCM_CREDENTIALS로 송신자를 식별한다.
+class DatagramReceiver {
+public:
+    // 데이터그램 해석 방식: syslog 헤더 파싱 또는 스트림과 같은 줄 단위 분리
+    enum class Format {
+        SYSLOG,
+        LINES
+    };
+
+    static constexpr unsigned int BATCH_SIZE = 64;
+    static constexpr size_t DATAGRAM_SIZE = 8192;
+    static constexpr int RECV_BUFFER_BYTES = 4 * 1024 * 1024;
+    static constexpr int RESUME_CHECK_MS = 100;
+
+    // fd의 소유권은 LogServer에 있음, shard는 이 수신기가 쓰는 버퍼 샤드
+    DatagramReceiver(LogServer* server, int fd, Format format, size_t shard);
+    ~DatagramReceiver();
+
+    DatagramReceiver(const DatagramReceiver&) = delete;
+    DatagramReceiver& operator=(const DatagramReceiver&) = delete;
+
+    void startThread();
+    void stop();
+    void join();
+
+private:
+    void run();
+    void drain();
+    bool blocked() const;
+    std::string peerSource(unsigned int index);
+
+    LogServer* server_;
+    int fd_;
+    Format format_;
+    size_t shard_;
+    bool unixSocket_;
+    int wakeupFd_;
+    std::atomic<bool> running_;
+    std::thread thread_;
+
+    // recvmmsg용 버퍼는 한 번만 할당하여 재사용
+    std::vector<char> buffers_;
+    std::vector<mmsghdr> msgs_;
+    std::vector<iovec> iovecs_;
+    std::vector<sockaddr_in> peers_;
+    std::vector<char> controls_;
+    std::vector<LogEntry> batch_;
+    std::vector<std::string> lines_;
+    // [SEQUENCE: CPP-MVP7-206]
+    // 속도 제한 SAMPLE 동작의 수신기 단위 카운터
+    uint64_t sampleCounter_;
+};
+
+#endif // DATAGRAMRECEIVER_H
@@ -0,0 +1,34 @@
+// [SEQUENCE: CPP-MVP7-49]
+#ifndef EPOLLREACTOR_H
+#define EPOLLREACTOR_H
+
+#include "Reactor.h"
+
+// [SEQUENCE: CPP-MVP7-50]
+// 엣지 트리거 epoll 리액터. 소켓 fd를 연결 키로 사용한다.
+class EpollReactor : public Reactor {
+public:
+    static constexpr int MAX_EPOLL_EVENTS = 256;
+
+    EpollReactor(LogServer* server, int id);
+    ~EpollReactor() override;
+
+    void addListener(int fd, Protocol protocol) override;
+    void run() override;
+    Backend getBackend() const override { return Backend::EPOLL; }
+
+protected:
+    void wake() override;
+
+private:
+    void handleAccept(int listenerFd, Protocol protocol);
+    void handleReadable(int fd);
+    void closeConnection(int fd);
+    void resumePaused();
+
+    int epollFd_;
+    int wakeupFd_;
+    std::unordered_map<int, Protocol> listeners_;
+};
+
+#endif // EPOLLREACTOR_H
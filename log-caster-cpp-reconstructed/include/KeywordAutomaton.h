@@ -0,0 +1,52 @@
+// [SEQUENCE: CPP-MVP7-367]
+#ifndef KEYWORDAUTOMATON_H
+#define KEYWORDAUTOMATON_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// [SEQUENCE: CPP-MVP7-368]
+// 키워드 여러 개를 한 번에 찾는 Aho-Corasick 자동자. 실패 링크를 전이표에 미리 펼친 DFA라 메시지 한 바이트마다
+// 표를 한 번만 읽고, 어느 키워드가 나왔는지 비트로 모아 AND(모두)/OR(하나라도)를 판정한다.
+// 키워드에 나오지 않는 바이트는 한 부류로 묶어 표의 열 수를 줄이고, 전이 값의 최상위 비트로
+// "이 상태에서 끝나는 키워드가 있음"을 표시해 대부분의 바이트는 표 읽기 한 번으로 끝난다.
+// 키워드 첫 바이트 종류가 적으면 루트 상태에서 다음 첫 바이트까지 SubstringSearch::findAnyOf로 건너뛴다
+// (루트에서 첫 바이트가 아닌 바이트는 루트로 되돌아오므로 결과는 같다).
+// 같은 키워드가 여러 번 주어지면 하나로 세고, 빈 키워드는 항상 나온 것으로 본다 (std::string::find와 같음).
+// 만든 뒤에는 읽기 전용이라 여러 검색 스레드가 함께 쓴다.
+class KeywordAutomaton {
+public:
+    explicit KeywordAutomaton(const std::vector<std::string>& keywords);
+
+    // all이면 모든 키워드가, 아니면 하나라도 text에 들어 있는지
+    bool matches(std::string_view text, bool all) const;
+
+    // 중복을 뺀 키워드 수와 상태 수
+    size_t keywordCount() const { return keywordCount_; }
+    size_t stateCount() const { return outStart_.size() - 1; }
+
+private:
+    // 키워드 수가 이만큼까지는 찾은 키워드 비트를 스택에 둠
+    static constexpr size_t INLINE_WORDS = 4;
+    static constexpr uint32_t OUTPUT = uint32_t(1) << 31;
+
+    // 바이트 → 열 번호 (0은 키워드에 없는 바이트)
+    std::array<uint16_t, 256> classOf_{};
+    size_t stride_ = 1;
+    // 전이표: [상태 * stride_ + 열] = 다음 상태 * stride_ (끝나는 키워드가 있으면 | OUTPUT)
+    std::vector<uint32_t> delta_;
+    // 상태마다 끝나는 키워드 번호 (실패 링크로 이어진 접미사 키워드 포함)
+    std::vector<uint32_t> outStart_;
+    std::vector<uint32_t> outIds_;
+    size_t keywordCount_ = 0;
+    bool hasEmpty_ = false;
+    // 키워드 첫 바이트 집합 (SubstringSearch::MAX_ANY_BYTES개 이하일 때만 루트 건너뛰기)
+    std::string starts_;
+    bool skipRoot_ = false;
+};
+
+#endif // KEYWORDAUTOMATON_H
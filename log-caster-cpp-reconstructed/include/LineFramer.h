@@ -0,0 +1,39 @@
+// [SEQUENCE: CPP-MVP7-79]
+#ifndef LINEFRAMER_H
+#define LINEFRAMER_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+// [SEQUENCE: CPP-MVP7-80]
+// 연결별 줄 단위 프레이밍.
+// 한 번의 recv에 여러 줄이 합쳐 오거나 한 줄이 여러 recv로 나뉘어 와도
+// '\n' 경계로 정확히 잘라내고, 불완전한 마지막 줄은 다음 읽기까지 보관한다.
+class LineFramer {
+public:
+    explicit LineFramer(size_t maxLineLength);
+
+    // data의 완성된 줄을 out에 추가하고, 추가한 줄 수를 반환
+    size_t feed(const char* data, size_t len, std::vector<std::string>& out);
+
+    // 연결 종료 시 남은 부분 줄을 방출
+    bool flush(std::vector<std::string>& out);
+
+    bool hasPartial() const { return !partial_.empty(); }
+
+    // [SEQUENCE: CPP-MVP7-386]
+    // 줄 단위가 아닌 수집 경로의 본문을 한 줄로 만듦. '\r', '\n', "\r\n"을 공백 하나로 바꿔
+    // QUERY 응답, IRC PRIVMSG, 영속성 파일에서 한 항목이 여러 줄로 보이거나 명령이 끼어들지 않게 함
+    static void flattenLineBreaks(std::string& text);
+
+private:
+    bool emit(const char* data, size_t len, bool truncated, std::vector<std::string>& out);
+    void appendPartial(const char* data, size_t len);
+
+    size_t maxLineLength_;
+    std::string partial_;
+    bool truncated_;
+};
+
+#endif // LINEFRAMER_H
@@ -2,18 +2,32 @@
 #ifndef LOGBUFFER_H
 #define LOGBUFFER_H
 
-#include <deque>
 #include <string>
+#include <algorithm>
 #include <mutex>
 #include <chrono>
 #include <vector>
 #include <atomic>
 #include <functional>
 #include <map>
+#include <memory>
+#include <shared_mutex>
+#include <utility>
+// [SEQUENCE: CPP-MVP7-214]
+#include "LogRing.h"
+// [SEQUENCE: CPP-MVP7-303]
+#include "TokenIndex.h"
+// [SEQUENCE: CPP-MVP7-318]
+#include "TrigramIndex.h"
+// [SEQUENCE: CPP-MVP7-327]
+#include "BlockFilter.h"
+// [SEQUENCE: CPP-MVP7-345]
+#include "ThreadPool.h"
 
 // [SEQUENCE: C-MVP3-11]
 // Forward declaration
 class ParsedQuery;
+class SegmentStore;
 
 // [SEQUENCE: CPP-MVP6-2]
 // LogEntry 확장 및 콜백 타입 정의
@@ -22,9 +36,15 @@ struct LogEntry {
     std::chrono::system_clock::time_point timestamp;
     std::string level;
     std::string source;
+    // [SEQUENCE: CPP-MVP7-107]
+    // 발생 애플리케이션/분류 (syslog APP-NAME 등). 없으면 빈 문자열
+    std::string category;
+    // [SEQUENCE: CPP-MVP7-147]
+    // 키/값 메타데이터 (바이너리 프로토콜 등 구조화된 수집 경로에서만 채워짐)
+    std::vector<std::pair<std::string, std::string>> metadata;
 
-    LogEntry(std::string msg, std::string lvl, std::string src)
-        : message(std::move(msg)), timestamp(std::chrono::system_clock::now()), level(std::move(lvl)), source(std::move(src)) {}
+    LogEntry(std::string msg, std::string lvl, std::string src, std::string cat = "")
+        : message(std::move(msg)), timestamp(std::chrono::system_clock::now()), level(std::move(lvl)), source(std::move(src)), category(std::move(cat)) {}
 };
 
 // [SEQUENCE: CPP-MVP6-3]
@@ -32,12 +52,79 @@ typedef std::function<void(const LogEntry&)> LogCallback;
 
 // [SEQUENCE: C-MVP2-16]
 // 로그 버퍼 클래스
+// [SEQUENCE: CPP-MVP7-220]
+// 생산자(리액터, 데이터그램 수신기)별 샤드로 나뉘며, 샤드마다 자체 락과 용량 몫을 가진 링을 둔다.
+// 검색은 샤드를 하나씩 잠가 결과를 모은 뒤 타임스탬프 순으로 병합한다.
 class LogBuffer {
 public:
-    explicit LogBuffer(size_t capacity = 10000);
+    // [SEQUENCE: CPP-MVP7-159]
+    // 용량 초과 시 처리 정책
+    //  DROP_OLDEST: 가장 오래된 항목 제거 (기본)
+    //  DROP_NEWEST: 새 항목을 버려 초기 기록 보존
+    //  BLOCK:       버리지 않고, 수집 측이 소켓 읽기를 멈춰 TCP 흐름 제어로 생산자를 늦춤
+    //  LEVEL_AWARE: 새 항목보다 낮은 레벨 중 가장 낮은 레벨의 가장 오래된 항목을 제거, 없으면 새 항목을 버림
+    enum class OverflowPolicy {
+        DROP_OLDEST,
+        DROP_NEWEST,
+        BLOCK,
+        LEVEL_AWARE
+    };
+
+    static const char* policyName(OverflowPolicy policy);
+    static bool parsePolicy(const std::string& name, OverflowPolicy& policy);
+    // DEBUG < INFO < WARN < ERROR 순위 (알 수 없는 레벨은 INFO)
+    static int levelRank(const std::string& level);
+
+    // [SEQUENCE: CPP-MVP7-328]
+    // 키워드/정규식 검색용 색인
+    //  FULL:  토큰 역색인 + 3글자 블록 색인 (후보가 정확하지만 항목당 수십 바이트)
+    //  BLOOM: 1024개 항목 블록마다 블룸 필터와 시간 범위만 둠 (항목당 4바이트 고정, 블록 단위로 건너뜀)
+    enum class IndexMode {
+        FULL,
+        BLOOM
+    };
+
+    static const char* indexModeName(IndexMode mode);
+    static bool parseIndexMode(const std::string& name, IndexMode& mode);
+
+    // [SEQUENCE: CPP-MVP7-215]
+    // [SEQUENCE: CPP-MVP7-260]
+    // 용량은 바이트 예산으로 정한다. 예산은 슬롯 열과 메시지 아레나를 합친 크기이며, 샤드마다
+    // 평균 메시지를 EXPECTED_MESSAGE_BYTES로 보고 슬롯 수를 정한 뒤 나머지를 아레나에 준다.
+    // 메시지가 짧으면 슬롯이, 길면 아레나가 먼저 차서 밀어내기가 시작된다. 128바이트는 80바이트 줄과
+    // 1KB 줄에서 예산 대비 보존량이 비슷해지는 값이다.
+    static constexpr size_t DEFAULT_BYTE_BUDGET = 10 * 1024 * 1024;
+    static constexpr size_t EXPECTED_MESSAGE_BYTES = 128;
+
+    // 샤드를 지정하지 않은 삽입은 호출 스레드로 샤드를 고름
+    static constexpr size_t ANY_SHARD = static_cast<size_t>(-1);
+
+    explicit LogBuffer(size_t byteBudget = DEFAULT_BYTE_BUDGET, size_t shards = 1);
     ~LogBuffer() = default;
 
+    // [SEQUENCE: CPP-MVP7-221]
+    // 샤드 수 변경 (수집 시작 이전에 호출). 기존 항목은 시간 순서대로 새 샤드들에 나누어 옮김
+    void setShardCount(size_t shards);
+    size_t shardCount() const { return shards_.size(); }
+    // 바이트 예산 변경 (수집 시작 이전에 호출). 기존 항목은 새 예산 안에서 최신 것부터 남음
+    void setByteBudget(size_t byteBudget);
+    size_t byteBudget() const { return budget_; }
+    // [SEQUENCE: CPP-MVP7-329]
+    // 색인 방식 변경 (수집 시작 이전에 호출). 기존 항목은 새 방식으로 다시 색인
+    void setIndexMode(IndexMode mode);
+    IndexMode getIndexMode() const { return indexMode_.load(std::memory_order_relaxed); }
+    // [SEQUENCE: CPP-MVP7-346]
+    // 한 검색을 나눠 훑을 스레드 수 (호출 스레드 포함, 1이면 나누지 않음). 수집 시작 이전에 호출
+    void setQueryThreads(size_t threads);
+    size_t queryThreads() const { return queryThreads_; }
+
     void push(std::string message, const std::string& level, const std::string& source);
+
+    // [SEQUENCE: CPP-MVP7-91]
+    // 여러 항목을 한 번의 락 획득으로 삽입. 넘겨받은 벡터는 비워짐
+    // (shard는 생산자 번호, 샤드 수로 나눈 나머지를 사용)
+    void pushBatch(std::vector<LogEntry>& entries, size_t shard = ANY_SHARD);
+    void pushBatch(std::vector<std::string>& messages, const std::string& level, const std::string& source);
     std::vector<std::string> search(const std::string& keyword) const;
 
     // [SEQUENCE: C-MVP3-12]
@@ -47,25 +134,165 @@ public:
     // [SEQUENCE: CPP-MVP6-4]
     void registerCallback(const std::string& channel, LogCallback callback);
 
+    // [SEQUENCE: CPP-MVP7-160]
+    void setOverflowPolicy(OverflowPolicy policy);
+    OverflowPolicy getOverflowPolicy() const { return policy_.load(std::memory_order_relaxed); }
+    // 락 없이 확인하는 여유 공간 여부 (수집 측 BLOCK 판단용, inflight는 아직 커밋되지 않은 항목 수)
+    // 생산자는 자신이 쓰는 샤드의 여유를 확인. 커밋 전 항목은 평균 메시지 크기로 어림함
+    bool hasSpace(size_t shard, size_t inflight = 0) const;
+    // BLOCK 정책으로 수집 연결을 멈춘 횟수 기록
+    void recordThrottle() { throttledLogs_++; }
+
     struct StatsSnapshot {
         uint64_t totalLogs;
         uint64_t droppedLogs;
+        // [SEQUENCE: CPP-MVP7-161]
+        // 정책별 세부 수치
+        uint64_t droppedOldest;
+        uint64_t droppedNewest;
+        uint64_t shedLogs;
+        uint64_t throttled;
+        // [SEQUENCE: CPP-MVP7-261]
+        // 메모리 수치 (바이트): 예산, 살아 있는 항목, 최대치, 아레나 구멍
+        uint64_t budgetBytes;
+        uint64_t liveBytes;
+        uint64_t peakBytes;
+        uint64_t fragmentedBytes;
+        // [SEQUENCE: CPP-MVP7-306]
+        // 키워드 역색인 (살아 있는 토큰 수, 항목이 남은 3글자 조합 수, 두 색인의 근사 바이트. 예산과 별도)
+        uint64_t indexTerms;
+        uint64_t indexTrigrams;
+        // [SEQUENCE: CPP-MVP7-330]
+        // BLOOM 방식의 블록 수 (근사 바이트는 indexBytes에 합산)
+        uint64_t indexBlocks;
+        uint64_t indexBytes;
     };
     StatsSnapshot getStats() const;
     size_t size() const;
 
+    // [SEQUENCE: CPP-MVP7-278]
+    // 밀려난 항목을 받을 디스크 계층 (샤드/예산 설정 이후, 수집 시작 이전에 호출).
+    // 연결되면 검색은 메모리 링과 디스크 계층을 함께 훑는다
+    void setSpillStore(std::shared_ptr<SegmentStore> store) { spill_ = std::move(store); }
+    std::shared_ptr<SegmentStore> spillStore() const { return spill_; }
+
+    // [SEQUENCE: CPP-MVP7-256]
+    // 레벨/source/category 사전 (영속성 레코드도 같은 id를 사용)
+    StringDictionary& dictionary() { return dictionary_; }
+    const StringDictionary& dictionary() const { return dictionary_; }
+
 private:
-    void dropOldest_();
+    // [SEQUENCE: CPP-MVP7-222]
+    // 샤드: 자체 락, 슬롯 링, LEVEL_AWARE용 레벨별 항목 수
+    // [SEQUENCE: CPP-MVP7-235]
+    // 락은 생산자끼리만 직렬화하며, 검색은 링을 락 없이 읽어 생산자를 기다리게 하지 않는다
+    // (락을 잡는 마지막 시도도 항목 복사까지만 하고 본문 검사는 락 밖에서 함)
+    static constexpr int LOCK_FREE_SCAN_ATTEMPTS = 3;
+    // [SEQUENCE: CPP-MVP7-347]
+    // 병렬 검색: 이 항목 수보다 작은 샤드는 나누지 않고(작업 전달 비용이 훑기보다 큼), limit가 있으면
+    // 샤드를 스레드 수의 LIMIT_SPLIT배 범위로 나눠 최신 범위부터 스레드 수만큼씩 훑다가 채워지면 멈춤
+    static constexpr size_t PARALLEL_MIN_ENTRIES = 16 * 1024;
+    static constexpr size_t LIMIT_SPLIT = 4;
+    static constexpr size_t NO_LIMIT = 0;
+    struct Shard {
+        Shard(size_t shardIndex, size_t budget, StringDictionary& dictionary)
+            : index(shardIndex), ring(slotsFor(budget), arenaFor(budget), dictionary) {}
+        static size_t slotsFor(size_t budget) {
+            return std::max<size_t>(1, budget / (LogRing::SLOT_BYTES + EXPECTED_MESSAGE_BYTES));
+        }
+        static size_t arenaFor(size_t budget) {
+            size_t slots = slotsFor(budget);
+            size_t fixed = slots * LogRing::SLOT_BYTES + LogRing::indexBytes(slots);
+            return budget > fixed ? budget - fixed : 1;
+        }
 
-    mutable std::mutex mutex_;
-    std::deque<LogEntry> buffer_;
-    size_t capacity_;
+        size_t index;
+        mutable std::mutex mutex;
+        // [SEQUENCE: CPP-MVP7-216]
+        // 항목 저장소: 미리 할당된 슬롯 링 + 메시지 아레나
+        LogRing ring;
+        // 링 항목의 키워드 역색인과 3글자 색인 (링과 함께 샤드 락 아래에서 갱신)
+        TokenIndex tokens;
+        TrigramIndex trigrams;
+        // BLOOM 방식에서 위 두 색인 대신 유지하는 블록 필터
+        BlockFilter blocks;
+        std::atomic<size_t> count{0};
+        // 락 없이 읽는 메모리 수치 (삽입 후 갱신)
+        std::atomic<size_t> liveBytes{0};
+        std::atomic<size_t> fragmentedBytes{0};
+        // LEVEL_AWARE에서 레벨 순위별 항목 수 (해당 정책일 때만 유지)
+        size_t levelCounts[4] = {0, 0, 0, 0};
+        // [SEQUENCE: CPP-MVP7-391]
+        // 레벨 순위별 가장 오래된 항목의 하한 (가장 오래된 항목 기준 순번, 이 앞에는 그 레벨 항목이 없음).
+        // 밀어낼 항목을 찾을 때 여기서부터 훑고, 앞 항목이 빠질 때마다 한 칸씩 당김
+        size_t levelCursors[4] = {0, 0, 0, 0};
+    };
+
+    Shard& shardFor_(size_t shard);
+    // 이하 샤드 락 보유 상태에서 호출
+    void dropOldest_(Shard& shard);
+    // [SEQUENCE: CPP-MVP7-162]
+    bool makeRoom_(Shard& shard, const LogEntry& entry);
+    bool shedLowerLevel_(Shard& shard, int rank);
+    void append_(Shard& shard, const LogEntry& entry);
+    void recountLevels_(Shard& shard);
+    // index 위치 항목이 링에서 빠진 뒤 그 뒤를 가리키던 레벨 커서를 한 칸 당김
+    void shiftLevelCursors_(Shard& shard, size_t index);
+    // 샤드 메모리 수치 갱신과 전체 최대치 기록
+    void updateBytes_(Shard& shard);
+    void rebuild_(size_t shards, size_t budget);
+    // [SEQUENCE: CPP-MVP7-92]
+    void notifyCallbacks_(const LogEntry& entry);
+    // [SEQUENCE: CPP-MVP7-223]
+    // 샤드별 일치 항목을 모아 타임스탬프 순으로 병합한 뒤 형식화
+    // [SEQUENCE: CPP-MVP7-304]
+    // keywords가 있으면 샤드마다 역색인으로 후보를 좁힘 (all: 모두 포함, 아니면 하나 이상)
+    // [SEQUENCE: CPP-MVP7-319]
+    // 색인으로 후보를 고를 때 쓰는 본문 조건. literals는 정규식에 반드시 나오는 문자열(대소문자 무시)
+    struct TextTerms {
+        std::vector<std::string> keywords;
+        bool all = true;
+        std::vector<std::string> literals;
+    };
+    template <typename Predicate>
+    std::vector<std::string> collect_(const LogRing::Filter& filter, const TextTerms& terms, Predicate matches,
+                                      size_t limit = NO_LIMIT) const;
+    // 샤드 색인으로 고른 후보 순번 (좁힐 수 없으면 false). BLOOM 방식은 filter의 시간 범위로도 블록을 거름
+    bool candidates_(const Shard& shard, const LogRing::Filter& filter, const TextTerms& terms,
+                     std::vector<uint64_t>& sequences) const;
+
+    // [SEQUENCE: CPP-MVP7-244]
+    // 모든 샤드가 공유하는 source/category/레벨 이름 사전 (샤드보다 먼저 생성되어야 함)
+    StringDictionary dictionary_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    size_t budget_;
+    std::atomic<size_t> count_{0};
+    std::atomic<size_t> liveBytes_{0};
+    std::atomic<size_t> peakBytes_{0};
 
     std::atomic<uint64_t> totalLogs_{0};
     std::atomic<uint64_t> droppedLogs_{0};
 
+    // [SEQUENCE: CPP-MVP7-163]
+    std::atomic<OverflowPolicy> policy_{OverflowPolicy::DROP_OLDEST};
+    std::atomic<uint64_t> droppedOldest_{0};
+    std::atomic<uint64_t> droppedNewest_{0};
+    std::atomic<uint64_t> shedLogs_{0};
+    std::atomic<uint64_t> throttledLogs_{0};
+    // [SEQUENCE: CPP-MVP7-331]
+    std::atomic<IndexMode> indexMode_{IndexMode::FULL};
+    // [SEQUENCE: CPP-MVP7-348]
+    // 검색 범위를 나눠 받는 작업자 (호출 스레드도 한 범위를 맡으므로 queryThreads_ - 1개)
+    size_t queryThreads_ = 1;
+    std::unique_ptr<ThreadPool> queryPool_;
+
     // [SEQUENCE: CPP-MVP6-5]
+    // 콜백은 여러 샤드의 삽입에서 동시에 호출되므로 별도 락으로 보호
+    mutable std::shared_mutex callbacksMutex_;
     std::map<std::string, std::vector<LogCallback>> callbacks_;
+
+    // [SEQUENCE: CPP-MVP7-279]
+    std::shared_ptr<SegmentStore> spill_;
 };
 
 #endif // LOGBUFFER_H
\ No newline at end of file
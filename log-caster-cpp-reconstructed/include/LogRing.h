@@ -0,0 +1,389 @@
+// [SEQUENCE: CPP-MVP7-207]
+#ifndef LOGRING_H
+#define LOGRING_H
+
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+// [SEQUENCE: CPP-MVP7-239]
+#include "StringDictionary.h"
+
+struct LogEntry;
+
+// [SEQUENCE: CPP-MVP7-208]
+// 고정 용량 슬롯 링과 메시지 아레나.
+// 슬롯은 생성 시 한 번 할당되어 재사용되고, 메시지 바이트는 하나의 순환 아레나에 연속으로 쌓인다.
+// [SEQUENCE: CPP-MVP7-229]
+// 쓰기(push/popFront/erase)는 호출자가 직렬화하고, 읽기(scan)는 락 없이 수행한다.
+// 슬롯 위치와 아레나 바이트 위치는 단조 증가하는 64비트 값이며, 쓰기 측은 위치를 fetch_add로 확보하고
+// 슬롯 시퀀스를 release로 게시한다. 읽기 측은 시퀀스(seqlock)와 아레나 덮어쓰기 여부를 검증해
+// 도중에 바뀐 항목은 건너뛴다. 슬롯을 옮기는 작업(중간 제거, 아레나 압축)은 세대 번호를 올려
+// 진행 중인 읽기가 처음부터 다시 하도록 한다.
+// [SEQUENCE: CPP-MVP7-240]
+// 슬롯은 열 단위로 저장한다: 시각(int64), 레벨 순위(uint8), source/category/레벨 이름의 사전 id,
+// 메시지의 아레나 위치와 길이. 검색은 시각/레벨/출처 열만 훑어 후보를 고른 뒤에야 메시지 바이트를 읽는다.
+class LogRing {
+public:
+    using Clock = std::chrono::system_clock;
+
+    // [SEQUENCE: CPP-MVP7-241]
+    // 열 검색 조건. ANY인 조건은 적용하지 않음
+    struct Filter {
+        static constexpr uint32_t ANY = StringDictionary::NONE;
+        Clock::rep timeFrom = std::numeric_limits<Clock::rep>::min();
+        Clock::rep timeTo = std::numeric_limits<Clock::rep>::max();
+        int level = -1;
+        uint32_t source = ANY;
+        uint32_t category = ANY;
+        // [SEQUENCE: CPP-MVP7-301]
+        // 역색인이 고른 후보 항목 순번 (오름차순). 있으면 이 항목들만 확인
+        const std::vector<uint64_t>* sequences = nullptr;
+        // [SEQUENCE: CPP-MVP7-341]
+        // 훑을 위치 범위 [fromPos, toPos) (병렬 검색에서 링을 나눌 때 사용, partition 참고)
+        uint64_t fromPos = 0;
+        uint64_t toPos = std::numeric_limits<uint64_t>::max();
+    };
+
+    // [SEQUENCE: CPP-MVP7-268]
+    // 밀려나는 항목을 다른 계층으로 옮길 때 쓰는 열 값 묶음 (message는 다음 쓰기 전까지만 유효)
+    struct Record {
+        Clock::rep timestamp;
+        uint64_t pos;
+        uint64_t generation;
+        uint64_t sequence;
+        uint32_t source;
+        uint32_t category;
+        int level;
+        std::string_view message;
+    };
+
+    // 훑기가 어느 항목을 직접 확인했는지 (밀려난 항목을 다른 계층에서 다시 셀지 판단할 때 사용)
+    //  head:     훑기 시작 시 가장 오래된 위치 (그 앞은 이미 밀려남)
+    //  frontier: 훑기 끝날 때 슬롯이 재사용되기 시작한 경계. [head, frontier)에서 examined에 없는
+    //            항목은 훑는 도중 밀려나 확인하지 못한 것
+    //  generation: 훑기가 기준으로 삼은 세대
+    struct ScanState {
+        uint64_t head = 0;
+        uint64_t frontier = 0;
+        uint64_t generation = 0;
+        std::vector<uint64_t> examined;
+    };
+
+    LogRing(size_t capacity, size_t arenaBytes, StringDictionary& dictionary);
+
+    LogRing(const LogRing&) = delete;
+    LogRing& operator=(const LogRing&) = delete;
+
+    size_t size() const { return static_cast<size_t>(tailPos_.load(std::memory_order_acquire) - headPos_.load(std::memory_order_acquire)); }
+    size_t capacity() const { return capacity_; }
+    bool empty() const { return size() == 0; }
+    size_t arenaBytes() const { return arenaSize_; }
+    size_t arenaUsed() const { return arenaUsed_; }
+
+    // [SEQUENCE: CPP-MVP7-258]
+    // 메모리 계산 (쓰기 측에서 호출). 슬롯 열과 아레나가 링이 차지하는 전부이며 생성 시 한 번 할당된다.
+    //  reservedBytes: 슬롯 수 * SLOT_BYTES + 시각 버킷 색인 + 아레나 크기
+    //  liveBytes:     살아 있는 항목의 슬롯 바이트 + 아레나에서 차지한 바이트(메시지와 메타데이터)
+    //  fragmentedBytes: 가장 오래된 항목부터 끝까지의 아레나 구간 중 중간 제거로 비어 있는 바이트
+    static constexpr size_t SLOT_BYTES = sizeof(std::atomic<uint64_t>) + sizeof(Clock::rep) + sizeof(uint8_t) +
+                                         3 * sizeof(uint32_t) + 2 * sizeof(uint64_t) + 2 * sizeof(uint32_t);
+    size_t reservedBytes() const { return capacity_ * SLOT_BYTES + indexBytes(capacity_) + arenaSize_; }
+    size_t liveBytes() const { return size() * SLOT_BYTES + arenaUsed_; }
+    size_t fragmentedBytes() const;
+
+    // [SEQUENCE: CPP-MVP7-291]
+    // 시각 버킷 색인: 위치를 TIME_BUCKET_SLOTS개씩 묶은 버킷마다 최소/최대 시각을 기록한다.
+    // 버킷 배열은 위치 기준 순환 배열이라 살아 있는 위치 범위의 버킷들이 서로 겹치지 않는다.
+    static constexpr size_t TIME_BUCKET_SLOTS = 256;
+    static size_t bucketsFor(size_t capacity) { return capacity / TIME_BUCKET_SLOTS + 2; }
+    static size_t indexBytes(size_t capacity) {
+        return bucketsFor(capacity) * (sizeof(std::atomic<uint64_t>) + 2 * sizeof(std::atomic<Clock::rep>));
+    }
+
+    // --- 쓰기 측 (호출자가 직렬화) ---
+    // entry를 넣을 슬롯과 아레나 여유가 있는지
+    bool hasRoom(const LogEntry& entry) const;
+    // 항목을 복사해 뒤에 추가 (hasRoom이 참이어야 함, 아레나보다 긴 메시지는 잘림)
+    void push(const LogEntry& entry);
+    void popFront();
+    // 가장 오래된 항목 기준 index 위치의 항목 제거 (더 가까운 끝 쪽 슬롯을 한 칸씩 옮김)
+    void erase(size_t index);
+    // 가장 오래된 항목 기준 index 위치의 레벨 순위, 또는 항목 전체 복원
+    int levelAt(size_t index) const { return levels_[slot(headPos_.load(std::memory_order_relaxed) + index)]; }
+    LogEntry entryAt(size_t index) const;
+    Record recordAt(size_t index, std::string& scratch) const;
+
+    // --- 읽기 측 (락 없음) ---
+    // [SEQUENCE: CPP-MVP7-230]
+    // filter를 통과하고 게시된 항목마다 visit(timestamp, message)를 호출. visit가 true를 반환하면 그 항목의 메시지를 out에 복사한다.
+    // 검증을 통과한 항목만 out에 남고, 세대가 바뀌어 일관된 결과를 못 얻으면 false (out은 비워짐)
+    template <typename Visit>
+    bool scan(const Filter& filter, Visit visit, std::vector<std::pair<Clock::time_point, std::string>>& out,
+              ScanState* state = nullptr) const;
+    // [SEQUENCE: CPP-MVP7-342]
+    // 현재 [head, tail)을 시각 버킷 경계에 맞춘 parts개 이하의 위치 범위로 나눔. 첫 범위는 0부터, 마지막 범위는
+    // 끝없이 열려 있어 나눈 뒤에 밀려나거나 추가된 항목도 한 범위에 속한다. 범위별 훑기 결과를 위치 순으로 이으면
+    // 같은 세대의 한 번 훑기와 같음
+    std::vector<std::pair<uint64_t, uint64_t>> partition(size_t parts) const;
+
+private:
+    // 쓰기 측이 반복되는 source/category/레벨 문자열마다 사전 락을 잡지 않도록 직전 값을 기억
+    struct InternCache {
+        std::string value;
+        uint32_t id = StringDictionary::NONE;
+    };
+    uint32_t intern(InternCache& cache, const std::string& value);
+    // 아레나에 들어갈 메시지 길이와 메타데이터 길이 (아레나보다 길면 메시지를 자르고 메타데이터는 버림)
+    std::pair<size_t, size_t> spanOf(const LogEntry& entry) const;
+
+    size_t slot(uint64_t pos) const { return static_cast<size_t>(pos % capacity_); }
+    bool passes(size_t index, const Filter& filter) const;
+    // [low, high)에서 순번이 sequence인 위치를 찾음. low는 찾은(또는 다음) 위치로 옮겨짐
+    bool locate(uint64_t sequence, uint64_t& low, uint64_t high) const;
+    // pos 슬롯의 순번 (그 위치 항목으로 게시된 상태가 아니면 false)
+    bool sequenceAt(uint64_t pos, uint64_t& value) const;
+    // pos 항목의 시각을 버킷에 반영 (처음 쓰는 버킷이면 새로 시작)
+    void indexTimestamp(uint64_t pos, Clock::rep timestamp);
+    // 버킷의 시각 범위. 버킷 자리가 더 새 버킷에 재사용되었으면(항목이 모두 밀려남) false
+    bool bucketRange(uint64_t bucket, Clock::rep& minTime, Clock::rep& maxTime) const;
+    void copyIn(uint64_t pos, const char* data, size_t length);
+    // [pos, pos+length)가 아레나 끝에서 감기지 않으면 그 위치의 포인터, 감기면 scratch에 복사 (쓰기 측 전용)
+    std::string_view view(uint64_t pos, size_t length, std::string& scratch) const;
+    // [SEQUENCE: CPP-MVP7-393]
+    // 읽기 측이 쓰기와 겹쳐 읽는 열과 아레나는 양쪽 모두 relaxed 원자 접근으로 다룬다. 검증 전에 읽은 값은
+    // 찢어졌을 수 있지만 데이터 경쟁은 아니며, 시퀀스/세대 재확인에서 버려진다. C++17에는 std::atomic_ref가
+    // 없으므로 같은 동작인 __atomic 내장 함수를 씀 (x86-64/AArch64에서는 일반 load/store와 같은 명령)
+    template <typename T>
+    static T loadRelaxed(const T& value) { return __atomic_load_n(&value, __ATOMIC_RELAXED); }
+    template <typename T>
+    static void storeRelaxed(T& value, T next) { __atomic_store_n(&value, next, __ATOMIC_RELAXED); }
+    // 아레나 오프셋 [offset, offset+length) (끝에서 감기지 않음)를 8바이트 단어 단위 원자 접근으로 복사.
+    // 단어 일부만 쓰는 경우 쓰기 측이 유일한 쓰기이므로 단어를 읽어 합친 뒤 통째로 씀
+    void storeBytes(size_t offset, const char* data, size_t length);
+    void loadBytes(size_t offset, char* out, size_t length) const;
+    // 읽기 측 복사: [pos, pos+length)를 scratch에 원자 접근으로 옮긴 뒤 그 뷰를 반환
+    std::string_view copyOut(uint64_t pos, size_t length, std::string& scratch) const;
+    const char* bytes() const { return reinterpret_cast<const char*>(arena_.get()); }
+    void compact();
+    void moveSlot(uint64_t from, uint64_t to);
+
+    size_t capacity_;
+    StringDictionary& dictionary_;
+    InternCache sourceCache_;
+    InternCache categoryCache_;
+    InternCache levelCache_;
+
+    // 2*pos+2: pos 위치 항목으로 게시됨, 홀수: 쓰는 중
+    std::unique_ptr<std::atomic<uint64_t>[]> seqs_;
+    // 읽기 측이 시퀀스로 검증하며 읽는 열 (쓰기 측은 storeRelaxed로 쓰고 읽기 측은 loadRelaxed로 읽음)
+    std::vector<Clock::rep> timestamps_;
+    std::vector<uint8_t> levels_;
+    std::vector<uint32_t> sources_;
+    std::vector<uint32_t> categories_;
+    std::vector<uint64_t> bytePos_;
+    std::vector<uint32_t> lengths_;
+    // 항목 순번 (push마다 1씩 증가하고 슬롯을 옮겨도 유지되어 역색인이 항목을 가리키는 데 씀)
+    std::vector<uint64_t> sequences_;
+    uint64_t nextSequence_ = 0;
+    // 쓰기 측 전용 열 (원래 레벨 문자열 id, 메시지 뒤에 직렬화된 메타데이터 길이)
+    std::vector<uint32_t> levelNames_;
+    std::vector<uint32_t> extraLengths_;
+
+    std::atomic<uint64_t> headPos_{0};
+    std::atomic<uint64_t> tailPos_{0};
+    std::atomic<uint64_t> generation_{0};
+
+    // [SEQUENCE: CPP-MVP7-292]
+    // 시각 버킷 색인. 항목이 밀려나도 범위를 줄이지 않으므로 범위는 실제보다 넓을 수만 있다.
+    // lastDisorder_는 직전 항목보다 이른 시각으로 들어온 마지막 위치로, 그 위치가 가장 오래된 항목이
+    // 되면(또는 밀려나면) 링 전체가 시각 순서이므로 시작 버킷을 이분 탐색할 수 있다.
+    size_t bucketCount_;
+    std::unique_ptr<std::atomic<uint64_t>[]> bucketIds_;
+    std::unique_ptr<std::atomic<Clock::rep>[]> bucketMin_;
+    std::unique_ptr<std::atomic<Clock::rep>[]> bucketMax_;
+    Clock::rep lastTimestamp_ = std::numeric_limits<Clock::rep>::min();
+    std::atomic<uint64_t> lastDisorder_{0};
+
+    // [SEQUENCE: CPP-MVP7-209]
+    // 메시지는 단조 바이트 위치 % arenaSize_에 저장되며 끝을 넘으면 앞으로 이어진다.
+    // 사용 영역은 가장 오래된 슬롯의 bytePos부터 arenaTail_까지다. 중간 항목 제거로 생긴 구멍은
+    // 가장 오래된 항목이 지나가거나 compact()에서 회수된다. arenaReserved_는 쓰기가 예약한 끝 위치로,
+    // 읽기 측은 이것이 메시지 위치보다 arenaSize_ 넘게 앞서면 덮어쓰인 것으로 본다.
+    // [SEQUENCE: CPP-MVP7-394]
+    // 단어 단위 원자 접근을 위해 uint64_t 배열로 할당 (바이트 용량은 arenaSize_)
+    std::unique_ptr<uint64_t[]> arena_;
+    size_t arenaSize_;
+    uint64_t arenaTail_ = 0;
+    std::atomic<uint64_t> arenaReserved_{0};
+    size_t arenaUsed_ = 0;
+};
+
+inline bool LogRing::bucketRange(uint64_t bucket, Clock::rep& minTime, Clock::rep& maxTime) const {
+    size_t index = static_cast<size_t>(bucket % bucketCount_);
+    if (bucketIds_[index].load(std::memory_order_acquire) != bucket) return false;
+    minTime = bucketMin_[index].load(std::memory_order_relaxed);
+    maxTime = bucketMax_[index].load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return bucketIds_[index].load(std::memory_order_relaxed) == bucket;
+}
+
+// [SEQUENCE: CPP-MVP7-302]
+// 검증에 실패한 슬롯은 밀려나 재사용된 것(찾는 항목보다 앞)으로 봄
+inline bool LogRing::sequenceAt(uint64_t pos, uint64_t& value) const {
+    size_t index = slot(pos);
+    uint64_t seq = seqs_[index].load(std::memory_order_acquire);
+    value = loadRelaxed(sequences_[index]);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return seq == 2 * pos + 2 && seqs_[index].load(std::memory_order_relaxed) == seq;
+}
+
+// 중간 제거가 없었다면 위치 차이와 순번 차이가 같으므로 그 자리를 먼저 보고, 아니면 그 자리로 좁힌 범위를 이분 탐색
+inline bool LogRing::locate(uint64_t sequence, uint64_t& low, uint64_t high) const {
+    uint64_t lowPos = low, highPos = high, value;
+    if (lowPos < highPos && sequenceAt(lowPos, value) && value <= sequence &&
+        sequence - value < highPos - lowPos) {
+        uint64_t guess = lowPos + (sequence - value);
+        if (!sequenceAt(guess, value) || value < sequence) {
+            lowPos = guess + 1;
+        } else if (value > sequence) {
+            highPos = guess;
+        } else {
+            low = guess;
+            return true;
+        }
+    }
+    while (lowPos < highPos) {
+        uint64_t mid = lowPos + (highPos - lowPos) / 2;
+        if (!sequenceAt(mid, value) || value < sequence) {
+            lowPos = mid + 1;
+        } else if (value > sequence) {
+            highPos = mid;
+        } else {
+            low = mid;
+            return true;
+        }
+    }
+    low = lowPos;
+    return false;
+}
+
+inline bool LogRing::passes(size_t index, const Filter& filter) const {
+    Clock::rep timestamp = loadRelaxed(timestamps_[index]);
+    return timestamp >= filter.timeFrom && timestamp <= filter.timeTo &&
+           (filter.level < 0 || loadRelaxed(levels_[index]) == filter.level) &&
+           (filter.source == Filter::ANY || loadRelaxed(sources_[index]) == filter.source) &&
+           (filter.category == Filter::ANY || loadRelaxed(categories_[index]) == filter.category);
+}
+
+// [SEQUENCE: CPP-MVP7-231]
+// 1단계: 열만 읽어 조건을 통과한 위치를 모음 (메시지 바이트는 건드리지 않음)
+// 2단계: 후보마다 시퀀스를 확인하고 열 조건을 다시 본 뒤 메시지를 읽고 검증
+// [SEQUENCE: CPP-MVP7-293]
+// 1단계는 시각 범위가 조건과 겹치지 않는 버킷을 통째로 건너뛴다. 링이 시각 순서이면 시작 버킷을
+// 이분 탐색으로 찾고, 버킷 최소 시각이 time_to를 넘으면 거기서 멈춘다.
+template <typename Visit>
+bool LogRing::scan(const Filter& filter, Visit visit, std::vector<std::pair<Clock::time_point, std::string>>& out,
+                   ScanState* state) const {
+    out.clear();
+    uint64_t generation = generation_.load(std::memory_order_acquire);
+    if (generation & 1) return false;
+    uint64_t head = std::max(headPos_.load(std::memory_order_acquire), filter.fromPos);
+    uint64_t tail = std::max(head, std::min(tailPos_.load(std::memory_order_acquire), filter.toPos));
+    if (state) {
+        state->head = head;
+        state->generation = generation;
+        state->examined.clear();
+    }
+
+    // tail을 acquire로 읽은 뒤이므로 tail 앞 항목의 순서 어긋남 기록이 보임
+    bool ordered = lastDisorder_.load(std::memory_order_relaxed) <= head;
+
+    std::vector<uint64_t> candidates;
+    uint64_t bucket = head / TIME_BUCKET_SLOTS;
+    uint64_t endBucket = tail > head ? (tail - 1) / TIME_BUCKET_SLOTS + 1 : bucket;
+    Clock::rep minTime, maxTime;
+    if (!filter.sequences && ordered && filter.timeFrom != std::numeric_limits<Clock::rep>::min()) {
+        // 최대 시각이 time_from 이상인 첫 버킷 (재사용된 버킷은 이미 밀려난 앞쪽 버킷)
+        uint64_t low = bucket, high = endBucket;
+        while (low < high) {
+            uint64_t mid = low + (high - low) / 2;
+            if (bucketRange(mid, minTime, maxTime) && maxTime >= filter.timeFrom) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+        bucket = low;
+    }
+    if (filter.sequences) {
+        // 역색인 후보: 위치를 찾아 열 조건만 확인 (시각 버킷은 건너뜀)
+        uint64_t low = head;
+        for (uint64_t sequence : *filter.sequences) {
+            if (locate(sequence, low, tail) && passes(slot(low), filter)) candidates.push_back(low);
+        }
+        bucket = endBucket;
+    }
+    for (; bucket < endBucket; ++bucket) {
+        if (!bucketRange(bucket, minTime, maxTime)) continue;
+        if (ordered && minTime > filter.timeTo) break;
+        if (maxTime < filter.timeFrom || minTime > filter.timeTo) continue;
+        uint64_t last = std::min(tail, (bucket + 1) * TIME_BUCKET_SLOTS);
+        for (uint64_t pos = std::max(head, bucket * TIME_BUCKET_SLOTS); pos < last;) {
+            // 링 끝에서 감기지 않는 연속 구간 단위로 훑음
+            size_t begin = slot(pos);
+            size_t end = static_cast<size_t>(std::min<uint64_t>(capacity_, begin + (last - pos)));
+            for (size_t index = begin; index < end; ++index) {
+                if (passes(index, filter)) candidates.push_back(pos + (index - begin));
+            }
+            pos += end - begin;
+        }
+    }
+
+    std::string scratch;
+    for (uint64_t pos : candidates) {
+        size_t index = slot(pos);
+        uint64_t seq = seqs_[index].load(std::memory_order_acquire);
+        if (seq != 2 * pos + 2) continue;  // 이미 밀려났거나 쓰는 중
+        if (!passes(index, filter)) continue;
+        Clock::time_point time{Clock::duration(loadRelaxed(timestamps_[index]))};
+        uint64_t bytePos = loadRelaxed(bytePos_[index]);
+        size_t length = loadRelaxed(lengths_[index]);
+        if (length > arenaSize_) continue;
+
+        // 쓰기가 겹쳐 찢어진 복사본일 수 있으나 아래 검증에 실패하면 결과에서 빠짐
+        std::string_view message = copyOut(bytePos, length, scratch);
+        bool keep = visit(time, message);
+        if (keep) out.emplace_back(time, std::string(message));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        bool valid = seqs_[index].load(std::memory_order_relaxed) == seq &&
+                     arenaReserved_.load(std::memory_order_relaxed) - bytePos <= arenaSize_;
+        if (generation_.load(std::memory_order_relaxed) != generation) {
+            out.clear();
+            return false;
+        }
+        if (keep && !valid) out.pop_back();
+        if (valid && state) state->examined.push_back(pos);
+    }
+    // 1단계만 거친 항목도 옮겨진 슬롯을 읽었을 수 있으므로 마지막에 세대를 다시 확인
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (generation_.load(std::memory_order_relaxed) != generation) {
+        out.clear();
+        return false;
+    }
+    if (state) {
+        uint64_t reused = tailPos_.load(std::memory_order_acquire);
+        state->frontier = reused > capacity_ ? std::max(head, reused - capacity_) : head;
+    }
+    return true;
+}
+
+#endif // LOGRING_H
@@ -5,16 +5,31 @@
 #include <memory>
 #include <atomic>
 #include <string>
+// [SEQUENCE: CPP-MVP7-1]
+#include <vector>
 // [SEQUENCE: CPP-MVP2-30]
 #include "Logger.h"
 #include "ThreadPool.h"
 #include "LogBuffer.h"
 #include "QueryHandler.h"
 #include "Persistence.h"
+// [SEQUENCE: CPP-MVP7-35]
+#include "Reactor.h"
+// [SEQUENCE: CPP-MVP7-114]
+#include "DatagramReceiver.h"
+// [SEQUENCE: CPP-MVP7-196]
+#include "RateLimiter.h"
+// [SEQUENCE: CPP-MVP7-282]
+#include "SegmentStore.h"
 
 // [SEQUENCE: CPP-MVP1-9]
 class LogServer {
 public:
+    // [SEQUENCE: CPP-MVP7-2]
+    static constexpr int MAX_CLIENTS = 1024;
+    static constexpr size_t SAFE_LOG_LENGTH = 1024;
+    static constexpr size_t MAX_QUERY_LENGTH = 4096;
+
     explicit LogServer(int port = 9999, int queryPort = 9998);
     ~LogServer();
 
@@ -28,23 +43,75 @@ public:
     // [SEQUENCE: CPP-MVP4-14]
     void setPersistenceManager(std::unique_ptr<PersistenceManager> persistence);
 
+    // [SEQUENCE: CPP-MVP7-36]
+    // 리액터 개수 설정 (start 이전에 호출). 2 이상이면 SO_REUSEPORT 리스너를 리액터마다 생성
+    void setReactorCount(size_t count);
+
+    // [SEQUENCE: CPP-MVP7-75]
+    // 수집 I/O 백엔드 선택 (start 이전에 호출). io_uring 미지원 커널에서는 epoll로 대체
+    void setIoBackend(Reactor::Backend backend);
+
+    // [SEQUENCE: CPP-MVP7-178]
+    // 버퍼 용량 초과 시 정책 설정
+    void setOverflowPolicy(LogBuffer::OverflowPolicy policy);
+    // [SEQUENCE: CPP-MVP7-264]
+    // 버퍼 메모리 예산 (바이트, start 이전에 호출)
+    void setBufferBudget(size_t bytes);
+    // [SEQUENCE: CPP-MVP7-335]
+    // 키워드/정규식 검색 색인 방식 (start 이전에 호출)
+    void setIndexMode(LogBuffer::IndexMode mode);
+    // [SEQUENCE: CPP-MVP7-353]
+    // 검색 하나를 나눠 훑을 스레드 수 (start 이전에 호출, 1이면 나누지 않음)
+    void setQueryThreads(size_t threads);
+    // [SEQUENCE: CPP-MVP7-283]
+    // 밀려난 항목을 보관할 디스크 계층 설정 (start 이전에 호출, 샤드 구성 뒤에 연결됨)
+    void setSpillConfig(const SegmentStoreConfig& config);
+
+    // [SEQUENCE: CPP-MVP7-197]
+    // 수집 속도 제한 설정 (start 이전에 호출). 한도가 없으면 제한하지 않음
+    void setRateLimit(const RateLimitConfig& config);
+
+    // [SEQUENCE: CPP-MVP7-153]
+    // 길이 접두 바이너리 수집 포트 설정 (start 이전에 호출, 0이면 비활성)
+    void setBinaryPort(int port);
+
+    // [SEQUENCE: CPP-MVP7-115]
+    // UDP syslog 수신 포트 설정 (start 이전에 호출, 0이면 비활성)
+    void setSyslogPort(int port);
+
+    // [SEQUENCE: CPP-MVP7-134]
+    // AF_UNIX 스트림/데이터그램 수집 소켓 경로 설정 (start 이전에 호출, 빈 문자열이면 비활성)
+    void setUnixSocketPaths(const std::string& streamPath, const std::string& dgramPath);
+
     // [SEQUENCE: CPP-MVP6-9]
     std::shared_ptr<LogBuffer> getLogBuffer() const { return logBuffer_; }
 
 private:
+    // [SEQUENCE: CPP-MVP7-37]
+    friend class Reactor;
+    // [SEQUENCE: CPP-MVP7-116]
+    friend class DatagramReceiver;
+
     // [SEQUENCE: CPP-MVP2-30]
     void initialize();
-    void runEventLoop();
-    void handleNewConnection(int listener_fd, bool is_query_port);
-    void handleClientTask(int client_fd);
-    void handleQueryTask(int client_fd);
+    // [SEQUENCE: CPP-MVP7-4]
+    void handleQueryTask(int client_fd, std::string query);
+    // [SEQUENCE: CPP-MVP7-117]
+    // 파싱이 끝난 항목 묶음 기록 (레벨/소스/분류를 가진 수집 경로용)
+    // [SEQUENCE: CPP-MVP7-227]
+    // shard는 생산자 번호: 리액터는 자기 id, 데이터그램 수신기는 리액터 다음 번호
+    void commitEntries(std::vector<LogEntry>& entries, size_t shard);
+    static std::string credentialSource(long pid, long uid);
 
     int port_;
     // [SEQUENCE: CPP-MVP2-30]
     int queryPort_;
-    int listenFd_;
+    // [SEQUENCE: CPP-MVP7-5]
+    // 리액터별 수집 리스너 (SO_REUSEPORT)와 단일 쿼리 리스너
+    std::vector<int> listenFds_;
     int queryFd_;
-    fd_set masterSet_;
+    size_t reactorCount_;
+    Reactor::Backend ioBackend_;
     std::atomic<bool> running_;
     
     std::unique_ptr<Logger> logger_;
@@ -55,8 +122,33 @@ private:
     // [SEQUENCE: CPP-MVP4-15]
     std::unique_ptr<PersistenceManager> persistence_;
 
+    // [SEQUENCE: CPP-MVP7-38]
+    std::vector<std::unique_ptr<Reactor>> reactors_;
+
+    // [SEQUENCE: CPP-MVP7-154]
+    int binaryPort_;
+
+    // [SEQUENCE: CPP-MVP7-118]
+    int syslogPort_;
+    int syslogFd_;
+    std::unique_ptr<DatagramReceiver> syslogReceiver_;
+
+    // [SEQUENCE: CPP-MVP7-135]
+    std::string unixStreamPath_;
+    std::string unixDgramPath_;
+    int unixStreamFd_;
+    int unixDgramFd_;
+    std::unique_ptr<DatagramReceiver> unixReceiver_;
+
+    // [SEQUENCE: CPP-MVP7-198]
+    // 모든 리액터와 데이터그램 수신기가 공유 (LIMITS 쿼리로 카운터 조회)
+    std::shared_ptr<RateLimiter> rateLimiter_;
+
+    // [SEQUENCE: CPP-MVP7-284]
+    SegmentStoreConfig spillConfig_;
+
     // [SEQUENCE: CPP-MVP5-1]
     std::atomic<int> client_count_{0};
 };
 
-#endif // LOGSERVER_H
\ No newline at end of file
+#endif // LOGSERVER_H
@@ -11,6 +11,11 @@
 #include <atomic>
 #include <chrono>
 #include <filesystem>
+#include <functional>
+#include <vector>
+#include <cstdint>
+// [SEQUENCE: CPP-MVP7-249]
+#include "LogBuffer.h"
 
 // [SEQUENCE: MVP4-5]
 // 영속성 설정을 위한 구조체
@@ -31,18 +36,48 @@ public:
     PersistenceManager(const PersistenceManager&) = delete;
     PersistenceManager& operator=(const PersistenceManager&) = delete;
 
-    void write(const std::string& message);
+    // [SEQUENCE: CPP-MVP7-250]
+    // 레벨/source/category를 id로 바꿀 사전 (LogBuffer와 같은 사전, write 이전에 설정)
+    void setDictionary(StringDictionary* dictionary) { dictionary_ = dictionary; }
+    void write(const LogEntry& entry);
+
+    // [SEQUENCE: CPP-MVP7-97]
+    // 현재 로그 파일을 읽어 배치 단위로 콜백에 전달. 전달한 줄 수를 반환
+    // [SEQUENCE: CPP-MVP7-251]
+    // 레코드의 시각, 레벨, source, category를 복원한 항목으로 전달 (이전 형식의 줄은 메시지만 복원)
+    using LoadCallback = std::function<void(std::vector<LogEntry>&)>;
+    size_t load(const LoadCallback& callback, size_t batchSize = 1024);
 
 private:
+    // [SEQUENCE: CPP-MVP7-252]
+    // 파일 형식 (줄 단위, RECORD_MARK로 시작하지 않는 줄은 이전 형식의 메시지)
+    //  RECORD_MARK 'D' <id> TAB <문자열>                           사전 정의, 이후 레코드에 적용
+    //  RECORD_MARK 'E' <시각> TAB <레벨 id> TAB <source id> TAB <category id> TAB <메시지>
+    // 정의는 파일마다 처음 쓰이는 id에 대해서만 레코드 앞에 한 번 기록한다.
+    // 메시지와 문자열 안의 '\\', 줄바꿈(\n, \r)은 "\\\\", "\\n", "\\r"로 기록한다.
+    static constexpr char RECORD_MARK = '\x1e';
+    struct Record {
+        int64_t timestamp;
+        uint32_t level;
+        uint32_t source;
+        uint32_t category;
+        std::string message;
+    };
+
     void writerThread();
     void rotateFile();
+    void writeDefinition(uint32_t id);
 
     PersistenceConfig config_;
     std::ofstream log_file_;
     std::filesystem::path current_filepath_;
     size_t current_file_size_ = 0;
 
-    std::queue<std::string> write_queue_;
+    StringDictionary* dictionary_ = nullptr;
+    // 현재 파일에 정의를 기록한 id (writer 스레드 전용, 파일을 바꾸면 비움)
+    std::vector<bool> defined_;
+
+    std::queue<Record> write_queue_;
     std::mutex queue_mutex_;
     std::condition_variable condition_;
     std::thread writer_thread_;
@@ -5,19 +5,24 @@
 #include <string>
 #include <memory>
 #include "LogBuffer.h"
+#include "RateLimiter.h"
 
 class QueryHandler {
 public:
     explicit QueryHandler(std::shared_ptr<LogBuffer> buffer);
     std::string processQuery(const std::string& query);
+    // [SEQUENCE: CPP-MVP7-200]
+    void setRateLimiter(std::shared_ptr<RateLimiter> limiter) { limiter_ = std::move(limiter); }
 
 private:
     std::string handleSearch(const std::string& query);
     std::string handleStats();
     std::string handleCount();
     std::string handleHelp();
+    std::string handleLimits();
 
     std::shared_ptr<LogBuffer> buffer_;
+    std::shared_ptr<RateLimiter> limiter_;
 };
 
 #endif // QUERYHANDLER_H
@@ -3,12 +3,14 @@
 #define QUERYPARSER_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <optional>
 #include <regex>
 #include <chrono>
 #include <memory>
 #include "LogBuffer.h" // For LogEntry
+#include "KeywordAutomaton.h"
 
 // [SEQUENCE: MVP3-4]
 // 쿼리 연산자 종류
@@ -21,16 +23,47 @@ enum class OperatorType {
 // 파싱된 쿼리 정보를 담는 클래스
 class ParsedQuery {
 public:
-    bool matches(const std::string& message, const std::chrono::system_clock::time_point& timestamp) const;
+    bool matches(std::string_view message, const std::chrono::system_clock::time_point& timestamp) const;
+    // [SEQUENCE: CPP-MVP7-242]
+    // 메시지 본문 조건(정규식, 키워드)만 검사. 시각/레벨/출처 조건은 LogBuffer가 열 단위로 먼저 거름
+    bool matchesText(std::string_view message) const;
+
+    const std::optional<std::chrono::system_clock::time_point>& timeFrom() const { return time_from_; }
+    const std::optional<std::chrono::system_clock::time_point>& timeTo() const { return time_to_; }
+    // 레벨 순위 (LogBuffer::levelRank), 출처, 분류 조건
+    const std::optional<int>& level() const { return level_; }
+    const std::optional<std::string>& source() const { return source_; }
+    const std::optional<std::string>& category() const { return category_; }
+    // [SEQUENCE: CPP-MVP7-307]
+    // 키워드 조건 (LogBuffer가 역색인 후보를 고를 때 사용)
+    const std::vector<std::string>& keywords() const { return keywords_; }
+    OperatorType op() const { return op_; }
+    // [SEQUENCE: CPP-MVP7-316]
+    // 정규식에 일치하는 메시지라면 반드시 들어 있는 고정 문자열들 (대소문자 무시, 3글자 색인 후보 선택용)
+    const std::vector<std::string>& regexLiterals() const { return regex_literals_; }
+    // [SEQUENCE: CPP-MVP7-343]
+    // 결과 수 상한 (가장 최근 일치 항목부터 limit개)
+    const std::optional<size_t>& limit() const { return limit_; }
+
+    // [SEQUENCE: CPP-MVP7-374]
+    // 키워드가 이만큼 이상이면 키워드 목록을 Aho-Corasick 자동자 하나로 묶어 메시지를 한 번만 훑음.
+    // 그보다 적으면 키워드마다 SubstringSearch로 찾는 편이 빠름
+    static constexpr size_t KEYWORD_AUTOMATON_MIN = 12;
 
 private:
     friend class QueryParser; // QueryParser가 private 멤버에 접근할 수 있도록 허용
 
     std::vector<std::string> keywords_;
+    std::optional<KeywordAutomaton> keyword_automaton_;
     std::optional<std::regex> compiled_regex_;
+    std::vector<std::string> regex_literals_;
     std::optional<std::chrono::system_clock::time_point> time_from_;
     std::optional<std::chrono::system_clock::time_point> time_to_;
     OperatorType op_ = OperatorType::AND;
+    std::optional<int> level_;
+    std::optional<std::string> source_;
+    std::optional<std::string> category_;
+    std::optional<size_t> limit_;
 };
 
 // [SEQUENCE: MVP3-6]
@@ -0,0 +1,143 @@
+// [SEQUENCE: CPP-MVP7-182]
+#ifndef RATELIMITER_H
+#define RATELIMITER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// [SEQUENCE: CPP-MVP7-183]
+// 토큰 버킷. rate(초당 줄 수)로 채워지고 burst까지 쌓인다.
+// DELAY 동작에서는 음수(빚)까지 내려갈 수 있다.
+class TokenBucket {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    TokenBucket(double rate = 0, double burst = 0);
+
+    bool enabled() const { return rate_ > 0; }
+    // 채운 뒤 n개 중 지금 허용 가능한 개수
+    size_t available(size_t n, Clock::time_point now);
+    void consume(size_t n) { tokens_ -= static_cast<double>(n); }
+    // 빚을 갚고 한 줄을 다시 허용하기까지 남은 시간(초)
+    double secondsUntilAvailable() const;
+
+private:
+    void refill(Clock::time_point now);
+
+    double rate_;
+    double burst_;
+    double tokens_;
+    Clock::time_point last_;
+};
+
+// [SEQUENCE: CPP-MVP7-184]
+// 수집 속도 제한 설정. -R "conn=1000,source=5000,burst=200,action=sample,sample=10"
+struct RateLimitConfig {
+    enum class Action {
+        DROP,    // 한도를 넘는 줄을 버림
+        SAMPLE,  // 한도를 넘는 줄 중 N개마다 하나만 통과
+        DELAY    // 모두 받되 빚을 갚을 때까지 연결 읽기를 멈춤 (데이터그램은 DROP)
+    };
+
+    double connectionRate = 0;  // 연결당 초당 줄 수 (0이면 제한 없음)
+    double sourceRate = 0;      // 출발지(주소/자격 증명)당 초당 줄 수
+    double burst = 0;           // 버킷 크기 (0이면 각 rate와 같음)
+    Action action = Action::DROP;
+    unsigned sampleEvery = 10;
+
+    bool enabled() const { return connectionRate > 0 || sourceRate > 0; }
+    static bool parse(const std::string& spec, RateLimitConfig& config);
+    static const char* actionName(Action action);
+};
+
+// [SEQUENCE: CPP-MVP7-185]
+// 연결/출발지 토큰 버킷을 적용하는 수집 경로 필터. 출발지별 버킷과 카운터는 모든 리액터가 공유한다.
+// 연결 버킷은 호출자(리액터 연결)가 소유하며, 호출은 읽기 조각 단위로 한 번씩만 락을 잡는다.
+class RateLimiter {
+public:
+    static constexpr size_t MAX_TRACKED_SOURCES = 4096;
+
+    struct SourceCounters {
+        uint64_t passed = 0;
+        uint64_t dropped = 0;
+        uint64_t sampled = 0;   // 샘플링으로 버려진 줄
+        uint64_t delayed = 0;   // 빚으로 받아 연결을 늦춘 줄
+    };
+
+    explicit RateLimiter(const RateLimitConfig& config);
+
+    const RateLimitConfig& config() const { return config_; }
+    TokenBucket makeConnectionBucket() const;
+
+    // items[first..]에 한도를 적용해 제자리에서 걸러낸다.
+    // 반환값은 연결을 멈춰야 하는 시간(초, DELAY일 때만 0보다 큼)
+    template <typename T>
+    double apply(TokenBucket* connection, const std::string& source, std::vector<T>& items,
+                 size_t first, uint64_t& sampleCounter, bool canDelay);
+
+    std::string report() const;
+
+private:
+    struct SourceState {
+        TokenBucket bucket;
+        SourceCounters counters;
+    };
+    SourceState& sourceState(const std::string& source);
+
+    RateLimitConfig config_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, SourceState> sources_;
+};
+
+// [SEQUENCE: CPP-MVP7-186]
+template <typename T>
+double RateLimiter::apply(TokenBucket* connection, const std::string& source, std::vector<T>& items,
+                          size_t first, uint64_t& sampleCounter, bool canDelay) {
+    if (items.size() <= first) return 0;
+    size_t n = items.size() - first;
+    auto now = TokenBucket::Clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    SourceState& state = sourceState(source);
+    size_t granted = n;
+    if (connection && connection->enabled()) granted = connection->available(granted, now);
+    if (state.bucket.enabled()) granted = state.bucket.available(granted, now);
+    size_t over = n - granted;
+
+    if (over > 0 && config_.action == RateLimitConfig::Action::DELAY && canDelay) {
+        // 모두 받고 버킷을 빚으로 돌린 뒤, 빚이 큰 쪽만큼 연결을 멈춤
+        if (connection) connection->consume(n);
+        state.bucket.consume(n);
+        state.counters.passed += n;
+        state.counters.delayed += over;
+        double wait = state.bucket.secondsUntilAvailable();
+        if (connection) wait = std::max(wait, connection->secondsUntilAvailable());
+        return wait;
+    }
+
+    if (connection) connection->consume(granted);
+    state.bucket.consume(granted);
+    size_t kept = first + granted;
+    for (size_t i = first + granted; i < items.size(); ++i) {
+        bool keep = config_.action == RateLimitConfig::Action::SAMPLE && ++sampleCounter % config_.sampleEvery == 0;
+        if (!keep) continue;
+        if (i != kept) items[kept] = std::move(items[i]);
+        kept++;
+    }
+    size_t sampledIn = kept - first - granted;
+    state.counters.passed += granted + sampledIn;
+    if (config_.action == RateLimitConfig::Action::SAMPLE) {
+        state.counters.sampled += over - sampledIn;
+    } else {
+        state.counters.dropped += over;
+    }
+    items.erase(items.begin() + kept, items.end());
+    return 0;
+}
+
+#endif // RATELIMITER_H
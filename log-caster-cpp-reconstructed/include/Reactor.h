@@ -0,0 +1,152 @@
+// [SEQUENCE: CPP-MVP7-20]
+#ifndef REACTOR_H
+#define REACTOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+// [SEQUENCE: CPP-MVP7-86]
+#include "LineFramer.h"
+#include "BinaryFramer.h"
+#include "RateLimiter.h"
+#include "LogBuffer.h"
+
+class LogServer;
+
+// [SEQUENCE: CPP-MVP7-21]
+// 수집 리액터 공통 기반. 하나의 스레드가 자신의 리스너와 클라이언트 소켓을 모두 소유하며,
+// 한 번의 이벤트 처리 반복에서 읽은 메시지를 리액터 단위 배치로 모아 워커에 넘긴다.
+// [SEQUENCE: CPP-MVP7-46]
+// I/O 방식(epoll, io_uring)은 하위 클래스가 구현하고, 연결/배치/쿼리 처리는 여기서 공유한다.
+class Reactor {
+public:
+    // [SEQUENCE: CPP-MVP7-47]
+    enum class Backend {
+        EPOLL,
+        IO_URING
+    };
+
+    // [SEQUENCE: CPP-MVP7-148]
+    // 리스너/연결의 프로토콜: 줄 단위 텍스트 수집, 쿼리, 길이 접두 바이너리 수집
+    enum class Protocol {
+        TEXT,
+        QUERY,
+        BINARY
+    };
+
+    // 요청한 백엔드를 생성하되, 커널이 지원하지 않으면 epoll로 대체
+    static std::unique_ptr<Reactor> create(Backend backend, LogServer* server, int id);
+    static const char* backendName(Backend backend);
+
+    virtual ~Reactor();
+
+    Reactor(const Reactor&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+
+    virtual void addListener(int fd, Protocol protocol) = 0;
+    virtual void run() = 0;
+    virtual Backend getBackend() const = 0;
+
+    void startThread(int cpu);
+    void stop();
+    void join();
+
+    int getId() const { return id_; }
+
+protected:
+    struct Connection {
+        int fd;
+        bool isQuery;
+        std::string inbuf;
+        // [SEQUENCE: CPP-MVP7-87]
+        // 수집 연결의 읽기 간 부분 줄 보관
+        LineFramer framer;
+        // [SEQUENCE: CPP-MVP7-138]
+        // 항목의 source (AF_UNIX는 SO_PEERCRED 자격 증명)
+        std::string source;
+
+        // [SEQUENCE: CPP-MVP7-149]
+        // 바이너리 수집 연결만 디코더를 가짐
+        Protocol protocol;
+        std::unique_ptr<BinaryFramer> binary;
+
+        // [SEQUENCE: CPP-MVP7-191]
+        // 속도 제한: 연결 키, 출발지(주소 또는 uid), 연결 버킷, 샘플링 카운터, DELAY 재개 시각
+        uint64_t key = 0;
+        std::string peer;
+        TokenBucket bucket;
+        uint64_t sampleCounter = 0;
+        TokenBucket::Clock::time_point resumeAt {};
+
+        Connection(int f, Protocol proto, size_t maxLineLength, std::string src)
+            : fd(f), isQuery(proto == Protocol::QUERY), framer(maxLineLength), source(std::move(src)), protocol(proto) {
+            if (proto == Protocol::BINARY) {
+                binary = std::make_unique<BinaryFramer>(maxLineLength, source);
+            }
+        }
+    };
+
+    Reactor(LogServer* server, int id);
+
+    // 리액터 스레드를 깨우는 백엔드별 구현 (시그널 핸들러에서 호출 가능해야 함)
+    virtual void wake() = 0;
+
+    // [SEQUENCE: CPP-MVP7-48]
+    // 백엔드 공통 처리: 연결 등록/해제, 수신 데이터 소비, 쿼리 연결 인계
+    Connection* registerConnection(uint64_t key, int fd, Protocol protocol);
+    bool consume(Connection& conn, const char* data, size_t len);
+    bool isQueryComplete(const Connection& conn) const;
+    void dispatchQuery(uint64_t key);
+    void releaseConnection(uint64_t key);
+    void closeAllConnections();
+    void flushBatch();
+    void log(const std::string& message);
+    void appendLines(const std::string& source);
+
+    // [SEQUENCE: CPP-MVP7-170]
+    // BLOCK 정책: 버퍼가 가득 차면 수집 연결 읽기를 멈춰 TCP 흐름 제어로 생산자를 늦춤.
+    // 멈춘 연결은 paused_에 두고, 백엔드가 RESUME_CHECK_MS 주기로 여유를 확인해 재개한다.
+    static constexpr int RESUME_CHECK_MS = 100;
+    bool ingestBlocked() const;
+    void pauseConnection(uint64_t key);
+    // 버퍼가 가득 차 멈춘 경우 (STATS의 Throttled 집계)
+    void throttleConnection(uint64_t key);
+    // [SEQUENCE: CPP-MVP7-192]
+    // 속도 제한 DELAY로 멈춘 연결도 paused_를 공유하며, resumeAt 이후에만 재개
+    void delayConnection(Connection& conn, double seconds);
+    bool resumable(const Connection& conn, TokenBucket::Clock::time_point now) const;
+    // 멈춘 연결이 있을 때 다음 재개 확인까지 기다릴 시간 (없으면 -1)
+    int resumeTimeoutMs() const;
+
+    LogServer* server_;
+    int id_;
+    std::atomic<bool> running_;
+    std::unordered_map<uint64_t, std::unique_ptr<Connection>> connections_;
+    std::unordered_set<uint64_t> paused_;
+
+private:
+    void drainPending();
+
+    std::thread thread_;
+
+    // [SEQUENCE: CPP-MVP7-22]
+    // batch_는 리액터 스레드 전용, pending_은 워커로 넘어갈 대기 배치.
+    // 리액터당 워커 작업을 하나만 예약하여 연결별 순서를 보장한다.
+    // [SEQUENCE: CPP-MVP7-139]
+    // 프레이머가 잘라낸 줄은 lines_를 거쳐 연결의 source가 붙은 항목으로 batch_에 쌓임
+    std::vector<std::string> lines_;
+    std::vector<LogEntry> batch_;
+    std::mutex pendingMutex_;
+    std::vector<LogEntry> pending_;
+    bool scheduled_ = false;
+    // 워커에 넘겼지만 아직 버퍼에 들어가지 않은 항목 수 (BLOCK 판단에 포함)
+    std::atomic<size_t> pendingCount_{0};
+};
+
+#endif // REACTOR_H
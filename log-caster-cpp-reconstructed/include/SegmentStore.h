@@ -0,0 +1,150 @@
+// [SEQUENCE: CPP-MVP7-269]
+#ifndef SEGMENTSTORE_H
+#define SEGMENTSTORE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "LogRing.h"
+
+// [SEQUENCE: CPP-MVP7-270]
+// 밀려난 항목을 보관하는 디스크 계층 설정. -T <MB>로 켜고 -t로 디렉토리를 지정
+struct SegmentStoreConfig {
+    bool enabled = false;
+    std::filesystem::path directory = "./spill";
+    size_t diskBudget = 256 * 1024 * 1024;
+    size_t segmentBytes = 16 * 1024 * 1024;
+};
+
+// [SEQUENCE: CPP-MVP7-271]
+// LogBuffer에서 밀려난 항목을 메모리 매핑한 세그먼트 파일에 이어 쓰는 계층.
+// 세그먼트는 고정 크기로 만들어 mmap하고, 앞에서부터 레코드를 쓴 뒤 사용 길이를 release로 게시한다.
+// 읽기 측은 세그먼트 목록을 shared_ptr로 복사해 두고 락 없이 훑으므로, 예산을 넘어 제거된 가장 오래된
+// 세그먼트도 읽는 중인 검색이 끝날 때까지 매핑이 유지된다.
+// 레코드의 source/category는 LogBuffer 사전 id이므로 세그먼트는 프로세스 실행 동안만 유효하다.
+class SegmentStore {
+public:
+    // 항목이 링을 떠난 방식
+    //  POPPED:   가장 오래된 항목으로 밀려남
+    //  ERASED:   중간 제거(LEVEL_AWARE)로 빠짐
+    //  DETACHED: 링에 들어가지 못함 (배치가 샤드보다 커서 앞부분이 바로 밀려남)
+    enum Kind : uint8_t { POPPED, ERASED, DETACHED };
+
+    // 레코드 앞부분 (메시지 바이트가 바로 뒤에 이어지고, 다음 레코드는 8바이트 경계에서 시작)
+    // pos/generation은 밀려나기 전 링 위치와 세대로, 검색 시 링에서 이미 읽은 항목을 다시 세지 않는 데 쓴다
+    struct RecordHeader {
+        int64_t timestamp;
+        uint64_t pos;
+        uint64_t generation;
+        uint32_t source;
+        uint32_t category;
+        uint32_t length;
+        uint16_t shard;
+        uint8_t level;
+        uint8_t kind;
+    };
+
+    // [SEQUENCE: CPP-MVP7-277]
+    // 샤드별 링 훑기 상태(states)와 비교해 링 결과에 없는 레코드인지 판단
+    static bool missedBy(const RecordHeader& header, const std::vector<LogRing::ScanState>& states);
+
+    struct Stats {
+        uint64_t spilledLogs;
+        uint64_t discardedLogs;
+        uint64_t segments;
+        uint64_t diskBytes;
+    };
+
+    // 디렉토리를 만들지 못하면 std::runtime_error
+    explicit SegmentStore(const SegmentStoreConfig& config);
+    ~SegmentStore();
+
+    SegmentStore(const SegmentStore&) = delete;
+    SegmentStore& operator=(const SegmentStore&) = delete;
+
+    // 링에서 밀려나는 항목 기록 (샤드 락 보유 상태에서 호출). 세그먼트를 만들 수 없으면 버린 것으로 셈
+    void append(size_t shard, const LogRing::Record& record, Kind kind);
+
+    // [SEQUENCE: CPP-MVP7-272]
+    // filter를 통과하고 include(header)가 참인 레코드마다 visit(timestamp, message) 호출,
+    // visit가 true면 out에 복사. 결과는 기록 순서(샤드별로는 시간 순)
+    template <typename Include, typename Visit>
+    void scan(const LogRing::Filter& filter, Include include, Visit visit,
+              std::vector<std::pair<LogRing::Clock::time_point, std::string>>& out) const;
+
+    Stats stats() const;
+
+private:
+    struct Segment {
+        Segment(const std::filesystem::path& path, size_t capacity);
+        ~Segment();
+
+        std::filesystem::path path;
+        char* base = nullptr;
+        size_t capacity;
+        std::atomic<size_t> used{0};
+        std::atomic<int64_t> minTimestamp{INT64_MAX};
+        std::atomic<int64_t> maxTimestamp{INT64_MIN};
+        size_t records = 0;
+    };
+
+    static constexpr size_t ALIGNMENT = 8;
+    static size_t recordBytes(size_t length) {
+        return (sizeof(RecordHeader) + length + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+    std::vector<std::shared_ptr<Segment>> snapshot() const;
+    void openSegment();
+
+    static constexpr std::chrono::seconds OPEN_RETRY_INTERVAL{1};
+
+    SegmentStoreConfig config_;
+    size_t maxSegments_;
+    // 세그먼트 생성이 실패한 뒤 다시 시도할 시각 (mutex_ 보호, 기본값이면 실패 중이 아님)
+    std::chrono::steady_clock::time_point retryOpenAt_{};
+    uint64_t nextSegmentId_ = 0;
+
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<Segment>> segments_;
+    std::atomic<uint64_t> spilledLogs_{0};
+    std::atomic<uint64_t> discardedLogs_{0};
+};
+
+template <typename Include, typename Visit>
+void SegmentStore::scan(const LogRing::Filter& filter, Include include, Visit visit,
+                        std::vector<std::pair<LogRing::Clock::time_point, std::string>>& out) const {
+    for (const auto& segment : snapshot()) {
+        // 사용 길이를 먼저 읽어야 그 안의 레코드가 반영된 시각 범위를 봄
+        size_t used = segment->used.load(std::memory_order_acquire);
+        if (segment->maxTimestamp.load(std::memory_order_relaxed) < filter.timeFrom ||
+            segment->minTimestamp.load(std::memory_order_relaxed) > filter.timeTo) {
+            continue;
+        }
+        for (size_t offset = 0; offset < used;) {
+            RecordHeader header;
+            std::memcpy(&header, segment->base + offset, sizeof(header));
+            const char* message = segment->base + offset + sizeof(header);
+            offset += recordBytes(header.length);
+
+            if (header.timestamp < filter.timeFrom || header.timestamp > filter.timeTo) continue;
+            if (filter.level >= 0 && header.level != filter.level) continue;
+            if (filter.source != LogRing::Filter::ANY && header.source != filter.source) continue;
+            if (filter.category != LogRing::Filter::ANY && header.category != filter.category) continue;
+            if (!include(header)) continue;
+
+            LogRing::Clock::time_point time{LogRing::Clock::duration(header.timestamp)};
+            std::string_view text(message, header.length);
+            if (visit(time, text)) out.emplace_back(time, std::string(text));
+        }
+    }
+}
+
+#endif // SEGMENTSTORE_H
@@ -0,0 +1,49 @@
+// [SEQUENCE: CPP-MVP7-236]
+#ifndef STRINGDICTIONARY_H
+#define STRINGDICTIONARY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// [SEQUENCE: CPP-MVP7-237]
+// 문자열 인턴 사전. 같은 문자열에 항상 같은 작은 정수 id를 주며, id는 지워지지 않는다.
+// LogBuffer의 source/category/레벨 열과 영속성 파일의 레코드가 이 id를 저장한다.
+// [SEQUENCE: CPP-MVP7-247]
+// id -> 문자열(lookup)은 락 없이 읽는다. 문자열은 고정 크기 청크에 한 번 쓰인 뒤 옮겨지지 않고,
+// 개수(size_)를 release로 올려 게시한다. 문자열 -> id는 shared_mutex로 보호하며
+// 이미 있는 문자열은 공유 락만으로 찾는다.
+class StringDictionary {
+public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+    static constexpr size_t CHUNK_SIZE = 1024;
+    static constexpr size_t MAX_CHUNKS = 4096;
+
+    StringDictionary();
+    ~StringDictionary();
+    StringDictionary(const StringDictionary&) = delete;
+    StringDictionary& operator=(const StringDictionary&) = delete;
+
+    // 없으면 새 id를 할당 (CHUNK_SIZE * MAX_CHUNKS개를 넘으면 NONE)
+    uint32_t intern(std::string_view value);
+    // 이미 있는 문자열의 id, 없으면 NONE (검색 조건을 id로 바꿀 때 사용)
+    uint32_t find(std::string_view value) const;
+    // 락 없음. 반환된 참조는 사전이 살아 있는 동안 유효. 모르는 id는 빈 문자열
+    const std::string& lookup(uint32_t id) const;
+    size_t size() const { return size_.load(std::memory_order_acquire); }
+
+private:
+    mutable std::shared_mutex mutex_;
+    // 맵 키는 청크 안의 문자열을 가리킴
+    std::unordered_map<std::string_view, uint32_t> ids_;
+    std::unique_ptr<std::atomic<std::string*>[]> chunks_;
+    std::atomic<uint32_t> size_{0};
+};
+
+#endif // STRINGDICTIONARY_H
@@ -0,0 +1,33 @@
+// [SEQUENCE: CPP-MVP7-357]
+#ifndef SUBSTRINGSEARCH_H
+#define SUBSTRINGSEARCH_H
+
+#include <cstddef>
+#include <string_view>
+
+// [SEQUENCE: CPP-MVP7-358]
+// 키워드 조건용 부분 문자열 검색. 찾을 문자열의 첫 바이트와 마지막 바이트를 벡터 레지스터에 채워 두고,
+// 본문을 32/16바이트씩 두 위치에서 한 번에 비교해 두 바이트가 모두 맞는 자리만 나머지를 memcmp로 확인한다.
+// 로그 메시지에서는 첫/끝 바이트가 함께 맞는 자리가 드물어 대부분 비교 두 번으로 블록을 넘긴다.
+// 커널은 처음 호출할 때 CPU 기능을 보고 한 번 고른다 (AVX2 > SSE2 > 스칼라). x86이 아니면 스칼라만 쓴다.
+// 키워드 쿼리와 LogBuffer::search가 같은 커널을 쓴다.
+// 같은 방식으로 작은 바이트 집합 중 하나를 찾는 findAnyOf도 둔다.
+class SubstringSearch {
+public:
+    // needle이 처음 나오는 위치 (없으면 npos). 빈 needle은 0
+    static size_t find(std::string_view haystack, std::string_view needle);
+    static bool contains(std::string_view haystack, std::string_view needle) {
+        return find(haystack, needle) != std::string_view::npos;
+    }
+
+    // [SEQUENCE: CPP-MVP7-373]
+    // bytes 중 어느 한 바이트가 처음 나오는 위치 (없으면 npos). 블록을 집합 바이트마다 한 번씩 비교하므로
+    // 벡터 커널은 MAX_ANY_BYTES개까지만 쓰고, 그보다 크면 스칼라로 찾음 (KeywordAutomaton의 루트 상태 건너뛰기)
+    static constexpr size_t MAX_ANY_BYTES = 8;
+    static size_t findAnyOf(std::string_view haystack, std::string_view bytes);
+
+    // 선택된 커널 이름 ("avx2", "sse2", "scalar")
+    static const char* kernelName();
+};
+
+#endif // SUBSTRINGSEARCH_H
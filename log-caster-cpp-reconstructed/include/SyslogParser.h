@@ -0,0 +1,22 @@
+// [SEQUENCE: CPP-MVP7-99]
+#ifndef SYSLOGPARSER_H
+#define SYSLOGPARSER_H
+
+#include <cstddef>
+#include <string>
+#include "LogBuffer.h"
+
+// [SEQUENCE: CPP-MVP7-100]
+// syslog 데이터그램 파서 (RFC 5424, RFC 3164 BSD 형식).
+// PRI의 심각도는 level, HOSTNAME은 source, APP-NAME/TAG는 category로 옮긴다.
+// 수신 시각을 타임스탬프로 사용하므로 헤더의 TIMESTAMP는 건너뛴다.
+class SyslogParser {
+public:
+    // 헤더가 없거나 깨진 경우 전체를 메시지로, peer를 source로 사용
+    static LogEntry parse(const char* data, size_t len, const std::string& peer);
+
+    // 심각도(0-7)를 버퍼 레벨 문자열로 변환
+    static const char* severityLevel(int severity);
+};
+
+#endif // SYSLOGPARSER_H
@@ -0,0 +1,94 @@
+// [SEQUENCE: CPP-MVP7-295]
+#ifndef TOKENINDEX_H
+#define TOKENINDEX_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// [SEQUENCE: CPP-MVP7-296]
+// 샤드 항목의 역색인: 메시지를 토큰(영숫자와 UTF-8 바이트의 연속)으로 나눠 토큰마다 항목 순번 목록을 둔다.
+// 삽입 시 추가하고 항목이 링에서 밀려나거나 제거될 때 지운다. 순번은 링이 항목마다 붙이는 단조 증가 값이며
+// 가장 오래된 항목이 목록 맨 앞에 있으므로 밀려난 항목은 앞 위치만 옮겨 지운다.
+// 키워드 조건은 부분 문자열 일치이므로, 색인은 일치할 수 있는 항목 후보만 고르고 본문 검사는 호출자가 한다.
+// 토큰 문자열은 하나의 어휘 버퍼에 이어 붙여 두어, 키워드를 품은 토큰을 어휘 버퍼 한 번 훑기로 찾는다.
+// 요청 번호, 소요 시간 같은 긴 숫자 토큰은 거의 항목마다 달라 색인 크기만 키우므로 넣지 않는다.
+// 쓰기(add/remove)는 샤드 락 아래에서 호출되고, 검색은 공유 락으로 후보만 복사한 뒤 바로 놓는다.
+class TokenIndex {
+public:
+    static bool isTokenChar(unsigned char c) {
+        return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c >= 0x80;
+    }
+    // 숫자로만 된 토큰은 이 길이까지만 색인 (상태 코드 등)
+    static constexpr size_t MAX_NUMERIC_TOKEN = 4;
+
+    void add(uint64_t sequence, std::string_view message);
+    void remove(uint64_t sequence, std::string_view message);
+
+    // [SEQUENCE: CPP-MVP7-297]
+    // keywords를 모두(all) 또는 하나라도 품을 수 있는 항목 순번을 오름차순으로 out에 채움.
+    // 토큰 문자가 없는 키워드처럼 색인으로 좁힐 수 없거나 후보가 limit를 넘으면 false (전체 훑기)
+    bool candidates(const std::vector<std::string>& keywords, bool all, size_t limit,
+                    std::vector<uint64_t>& out) const;
+
+    // 락 없이 읽는 수치 (살아 있는 토큰 수, 어휘/목록/해시 노드를 합친 근사 바이트)
+    size_t termCount() const { return termCount_.load(std::memory_order_relaxed); }
+    size_t bytes() const { return bytes_.load(std::memory_order_relaxed); }
+
+private:
+    // 순번은 하위 32비트만 저장. 살아 있는 항목은 링 용량 안에 있으므로 가장 최근 순번 기준으로 복원된다
+    struct Term {
+        size_t offset = 0;
+        uint32_t length = 0;
+        uint32_t front = 0;
+        std::vector<uint32_t> postings{};
+        size_t live() const { return postings.size() - front; }
+    };
+    static constexpr uint32_t NONE = UINT32_MAX;
+    static constexpr uint64_t EMPTY = UINT64_MAX;
+    // 키워드의 토큰 문자 구간. 구간 앞/뒤가 키워드 안의 구분 문자이면 토큰도 그 자리에서 시작/끝남
+    struct Run {
+        std::string_view text;
+        bool startsToken;
+        bool endsToken;
+    };
+
+    template <typename Visit>
+    static void forEachToken(std::string_view message, Visit visit);
+    static bool indexed(std::string_view token);
+    std::string_view tokenOf(const Term& term) const { return {vocabulary_.data() + term.offset, term.length}; }
+    // 토큰 id 찾기/등록 (해시 표는 (해시 상위 32비트, id) 쌍의 선형 탐사 표)
+    uint32_t find(std::string_view token) const;
+    uint32_t intern(std::string_view token);
+    void insertSlot(uint32_t hash, uint32_t id);
+    uint64_t widen(uint32_t stored) const {
+        return latest_ - static_cast<uint32_t>(static_cast<uint32_t>(latest_) - stored);
+    }
+    // 키워드 하나에 대한 후보 (색인으로 좁힐 수 없으면 false)
+    bool match(std::string_view keyword, size_t limit, std::vector<uint64_t>& out) const;
+    // 구간에 맞는 살아 있는 토큰 (항목 수 합이 limit를 넘으면 false), 토큰들의 순번 합집합
+    bool termsFor(const Run& run, size_t limit, std::vector<uint32_t>& ids) const;
+    void collect(const std::vector<uint32_t>& ids, std::vector<uint64_t>& out) const;
+    void dropTerm(uint32_t id);
+    void rebuildVocabulary();
+    void updateStats();
+
+    mutable std::shared_mutex mutex_;
+    // 토큰을 '\0'로 구분해 이어 붙인 어휘 버퍼. terms_의 offset 순서와 같음
+    std::string vocabulary_;
+    std::vector<Term> terms_;
+    std::vector<uint64_t> table_;
+    size_t deadTerms_ = 0;
+    size_t postingCount_ = 0;
+    uint64_t latest_ = 0;
+    std::vector<uint32_t> scratch_;
+
+    std::atomic<size_t> termCount_{0};
+    std::atomic<size_t> bytes_{0};
+};
+
+#endif // TOKENINDEX_H
@@ -0,0 +1,85 @@
+// [SEQUENCE: CPP-MVP7-310]
+#ifndef TRIGRAMINDEX_H
+#define TRIGRAMINDEX_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// [SEQUENCE: CPP-MVP7-311]
+// 샤드 항목의 3글자 색인: 메시지의 연속한 세 바이트마다, 그 조합이 나온 블록(항목 순번 BLOCK_ENTRIES개 단위) 목록을 둔다.
+// 토큰 색인이 다루지 못하는 식별자 조각(요청 번호, 호스트 이름 일부)과 정규식의 고정 문자열로 후보 블록을 고른다.
+// 바이트는 6비트 부류로 접어(영문 대소문자는 같은 부류) 세 글자 조합을 2^18칸 직접 표로 찾으므로, 대소문자를
+// 무시하는 정규식에도 쓸 수 있고 후보는 실제보다 넓을 수만 있다 (본문 검사는 호출자가 한다).
+// 블록 단위라 같은 조합이 한 블록에 여러 번 나와도 한 번만 기록한다. 밀려난 블록은 목록에 추가할 때와
+// 블록이 빌 때마다 조금씩 표를 돌며 앞에서 잘라 내고, 중간 제거된 항목은 블록에 남겨 둔다.
+// 쓰기(add/evict)는 샤드 락 아래에서 호출되고, 검색은 공유 락으로 후보만 계산한다.
+class TrigramIndex {
+public:
+    static constexpr size_t BLOCK_ENTRIES = 128;
+    static constexpr size_t KEY_BITS = 18;
+    static constexpr size_t KEYS = size_t(1) << KEY_BITS;
+
+    // 바이트의 6비트 부류와, 직전 두 바이트의 키에 다음 바이트를 이은 3글자 키 (BlockFilter도 같은 키를 씀)
+    static uint32_t classOf(unsigned char c);
+    static uint32_t nextKey(uint32_t key, char c) {
+        return ((key << 6) | classOf(static_cast<unsigned char>(c))) & (KEYS - 1);
+    }
+
+    void add(uint64_t sequence, std::string_view message);
+    // 가장 오래된 항목(sequence)이 링에서 밀려남
+    void evict(uint64_t sequence);
+
+    // [SEQUENCE: CPP-MVP7-312]
+    // required 문자열을 모두(all) 또는 하나라도 품을 수 있는 블록의 항목 순번을 오름차순으로 out에 채움.
+    // 세 글자보다 짧은 문자열처럼 좁힐 수 없거나 후보가 limit를 넘으면 false (전체 훑기)
+    bool candidates(const std::vector<std::string>& required, bool all, size_t limit,
+                    std::vector<uint64_t>& out) const;
+
+    // 락 없이 읽는 수치 (항목이 남아 있는 조합 수, 표/목록 근사 바이트)
+    size_t trigramCount() const { return trigramCount_.load(std::memory_order_relaxed); }
+    size_t bytes() const { return bytes_.load(std::memory_order_relaxed); }
+
+private:
+    // 블록이 빌 때마다 앞을 잘라 낼 목록 수 (표 전체를 KEYS / SWEEP_LISTS 블록마다 한 바퀴)
+    static constexpr size_t SWEEP_LISTS = 1024;
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    // 블록 번호는 하위 32비트만 저장 (TokenIndex 순번과 같은 방식으로 최근 블록 기준 복원)
+    struct Slot {
+        uint32_t list = NONE;
+        uint32_t lastBlock = NONE;
+    };
+    struct List {
+        uint32_t front = 0;
+        std::vector<uint32_t> blocks;
+        size_t live() const { return blocks.size() - front; }
+    };
+
+    uint64_t widen(uint32_t stored) const {
+        uint64_t latest = latest_ / BLOCK_ENTRIES;
+        return latest - static_cast<uint32_t>(static_cast<uint32_t>(latest) - stored);
+    }
+    void trim(List& list);
+    // literal의 모든 조합이 나온 블록 (세 글자보다 짧으면 false)
+    bool blocksFor(std::string_view literal, std::vector<uint64_t>& blocks) const;
+    void updateStats();
+
+    mutable std::shared_mutex mutex_;
+    std::vector<Slot> slots_;
+    std::vector<List> lists_;
+    uint64_t oldest_ = 0;
+    uint64_t latest_ = 0;
+    size_t sweep_ = 0;
+    size_t postingCount_ = 0;
+    size_t liveLists_ = 0;
+
+    std::atomic<size_t> trigramCount_{0};
+    std::atomic<size_t> bytes_{0};
+};
+
+#endif // TRIGRAMINDEX_H
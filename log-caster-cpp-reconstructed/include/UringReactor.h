@@ -0,0 +1,116 @@
+// [SEQUENCE: CPP-MVP7-59]
+#ifndef URINGREACTOR_H
+#define URINGREACTOR_H
+
+#include "Reactor.h"
+#include <unordered_set>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf;
+
+// [SEQUENCE: CPP-MVP7-60]
+// io_uring 리액터 (liburing 없이 시스템 콜로 직접 구성).
+// multishot accept, 등록된 provided buffer ring으로 받는 multishot recv를 사용하고,
+// 완료 큐를 한 번에 비운 뒤 배치를 커밋하여 recv당 시스템 콜을 없앤다.
+// 커널이 지원하지 않으면 생성자가 예외를 던지고 Reactor::create가 epoll로 대체한다.
+class UringReactor : public Reactor {
+public:
+    static constexpr unsigned RING_ENTRIES = 1024;
+    static constexpr unsigned BUFFER_COUNT = 1024; // 2의 거듭제곱
+    static constexpr unsigned BUFFER_SIZE = 4096;
+    static constexpr uint16_t BUFFER_GROUP = 0;
+
+    UringReactor(LogServer* server, int id);
+    ~UringReactor() override;
+
+    void addListener(int fd, Protocol protocol) override;
+    void run() override;
+    Backend getBackend() const override { return Backend::IO_URING; }
+
+protected:
+    void wake() override;
+
+private:
+    // user_data 상위 8비트: 작업 종류, 하위 56비트: 리스너 인덱스 또는 연결 ID
+    enum class Op : uint8_t {
+        ACCEPT = 1,
+        RECV,
+        CANCEL,
+        WAKE,
+        TIMEOUT
+    };
+    static uint64_t encode(Op op, uint64_t id) { return (static_cast<uint64_t>(op) << 56) | id; }
+
+    void setupRing();
+    void setupBufferRing();
+    void teardown();
+
+    io_uring_sqe* getSqe();
+    void submitAndWait(unsigned waitNr);
+    void armAccept(size_t listenerIndex);
+    void armRecv(uint64_t connId, int fd);
+    void armWake();
+    void cancelRecv(uint64_t connId);
+    void armResumeTimeout();
+    void resumePaused();
+
+    void processCompletions();
+    void handleAcceptCompletion(const io_uring_cqe& cqe, size_t listenerIndex);
+    void handleRecvCompletion(const io_uring_cqe& cqe, uint64_t connId);
+    void finishConnection(uint64_t connId);
+    void recycleBuffer(uint16_t bid);
+
+    int ringFd_;
+    int wakeupFd_;
+    uint64_t wakeValue_;
+
+    // 링 매핑
+    void* sqRingPtr_;
+    size_t sqRingSize_;
+    void* cqRingPtr_;
+    size_t cqRingSize_;
+    io_uring_sqe* sqes_;
+    size_t sqesSize_;
+
+    unsigned* sqHead_;
+    unsigned* sqTail_;
+    unsigned* sqMask_;
+    unsigned* sqArray_;
+    unsigned sqEntries_;
+    unsigned sqLocalTail_;
+    unsigned sqSubmittedTail_;
+
+    unsigned* cqHead_;
+    unsigned* cqTail_;
+    unsigned* cqMask_;
+    io_uring_cqe* cqes_;
+
+    // provided buffer ring (tail은 bufRing_[0]의 resv 필드에 겹쳐 있음)
+    io_uring_buf* bufRing_;
+    uint16_t* bufRingTail_;
+    size_t bufRingSize_;
+    char* bufferPool_;
+    uint16_t bufTail_;
+
+    struct ListenerInfo {
+        int fd;
+        Protocol protocol;
+    };
+    std::vector<ListenerInfo> listeners_;
+    uint64_t nextConnId_;
+    // 쿼리 요청을 다 받아 recv 취소를 기다리는 연결
+    std::unordered_set<uint64_t> detaching_;
+
+    // [SEQUENCE: CPP-MVP7-174]
+    // BLOCK 정책으로 멈춘 뒤 recv가 완전히 끝난 연결 (재개 시 recv를 다시 건다)
+    std::unordered_set<uint64_t> parked_;
+    // 멈춘 연결 재개 확인용 타이머 (__kernel_timespec과 같은 배치)
+    struct ResumeTimeout {
+        long long sec;
+        long long nsec;
+    } resumeTimeout_;
+    bool timeoutArmed_;
+};
+
+#endif // URINGREACTOR_H
@@ -0,0 +1,146 @@
+// [SEQUENCE: CPP-MVP7-143]
+#include "BinaryFramer.h"
+#include "LineFramer.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <endian.h>
+
+namespace {
+
+uint16_t readU16(const uint8_t* p) {
+    uint16_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return be16toh(v);
+}
+
+uint32_t readU32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return be32toh(v);
+}
+
+uint64_t readU64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return be64toh(v);
+}
+
+bool validFrameLength(uint32_t length) {
+    return length > 0 && length <= BinaryFramer::MAX_FRAME_SIZE;
+}
+
+} // namespace
+
+BinaryFramer::BinaryFramer(size_t maxMessageLength, std::string defaultSource)
+    : maxMessageLength_(maxMessageLength), defaultSource_(std::move(defaultSource)) {}
+
+// [SEQUENCE: CPP-MVP7-144]
+const std::string& BinaryFramer::levelName(uint8_t level) {
+    static const std::string names[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+    return names[std::min<uint8_t>(level, LEVEL_ERROR)];
+}
+
+// [SEQUENCE: CPP-MVP7-145]
+// 이전 읽기에서 남은 프레임을 먼저 완성한 뒤, 나머지는 수신 버퍼에서 직접 해석
+bool BinaryFramer::feed(const char* data, size_t len, std::vector<LogEntry>& out) {
+    const uint8_t* cur = reinterpret_cast<const uint8_t*>(data);
+    const uint8_t* end = cur + len;
+
+    while (!partial_.empty()) {
+        size_t need = HEADER_SIZE;
+        if (partial_.size() >= HEADER_SIZE) {
+            uint32_t length = readU32(partial_.data());
+            if (!validFrameLength(length)) return false;
+            need += length;
+        }
+        if (partial_.size() == need) {
+            bool ok = decode(partial_.data() + HEADER_SIZE, need - HEADER_SIZE, out);
+            partial_.clear();
+            if (!ok) return false;
+            break;
+        }
+        if (cur == end) return true;
+        size_t take = std::min<size_t>(need - partial_.size(), static_cast<size_t>(end - cur));
+        partial_.insert(partial_.end(), cur, cur + take);
+        cur += take;
+    }
+
+    while (static_cast<size_t>(end - cur) >= HEADER_SIZE) {
+        uint32_t length = readU32(cur);
+        if (!validFrameLength(length)) return false;
+        if (static_cast<size_t>(end - cur) < HEADER_SIZE + length) break;
+        if (!decode(cur + HEADER_SIZE, length, out)) return false;
+        cur += HEADER_SIZE + length;
+    }
+    partial_.assign(cur, end);
+    return true;
+}
+
+const std::string* BinaryFramer::lookup(uint16_t id) const {
+    if (id >= strings_.size() || strings_[id].empty()) return nullptr;
+    return &strings_[id];
+}
+
+// [SEQUENCE: CPP-MVP7-146]
+// 프레임 본문 해석. 고정 오프셋에서 필드를 읽고 문자열은 등록 테이블에서 찾는다
+bool BinaryFramer::decode(const uint8_t* body, size_t len, std::vector<LogEntry>& out) {
+    if (body[0] == FRAME_DEFINE) {
+        if (len < 5) return false;
+        uint16_t id = readU16(body + 1);
+        uint16_t strLen = readU16(body + 3);
+        if (id == 0 || id > MAX_INTERNED || strLen == 0 || len != 5u + strLen) return false;
+        if (id >= strings_.size()) strings_.resize(id + 1);
+        strings_[id].assign(reinterpret_cast<const char*>(body + 5), strLen);
+        return true;
+    }
+    if (body[0] != FRAME_LOG || len < LOG_HEADER_SIZE) return false;
+
+    uint8_t level = body[1];
+    uint8_t metaCount = body[2];
+    uint16_t sourceId = readU16(body + 4);
+    uint16_t categoryId = readU16(body + 6);
+    uint64_t timestampMicros = readU64(body + 8);
+
+    const std::string* source = sourceId == 0 ? &defaultSource_ : lookup(sourceId);
+    static const std::string noCategory;
+    const std::string* category = categoryId == 0 ? &noCategory : lookup(categoryId);
+    if (!source || !category) return false;
+
+    // 메타데이터 영역 검증 후 페이로드 위치 계산
+    size_t offset = LOG_HEADER_SIZE;
+    size_t metaStart = offset;
+    for (uint8_t i = 0; i < metaCount; ++i) {
+        if (len - offset < 4) return false;
+        uint16_t valueLen = readU16(body + offset + 2);
+        if (!lookup(readU16(body + offset)) || len - offset - 4 < valueLen) return false;
+        offset += 4u + valueLen;
+    }
+
+    size_t payloadLen = len - offset;
+    if (payloadLen == 0) return true;
+    bool truncated = payloadLen > maxMessageLength_;
+    out.emplace_back(std::string(reinterpret_cast<const char*>(body + offset), truncated ? maxMessageLength_ : payloadLen),
+                     levelName(level), *source, *category);
+    LogEntry& entry = out.back();
+    // [SEQUENCE: CPP-MVP7-388]
+    // 페이로드 안의 줄바꿈은 텍스트 수집 경로와 같이 한 줄로 만듦
+    LineFramer::flattenLineBreaks(entry.message);
+    if (truncated) {
+        entry.message += "...";
+    }
+    if (timestampMicros != 0) {
+        entry.timestamp = std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::microseconds(timestampMicros)));
+    }
+    if (metaCount > 0) {
+        entry.metadata.reserve(metaCount);
+        for (size_t pos = metaStart; pos < offset;) {
+            uint16_t valueLen = readU16(body + pos + 2);
+            entry.metadata.emplace_back(*lookup(readU16(body + pos)),
+                                        std::string(reinterpret_cast<const char*>(body + pos + 4), valueLen));
+            pos += 4u + valueLen;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,98 @@
+// [SEQUENCE: CPP-MVP7-325]
+#include "BlockFilter.h"
+#include "TrigramIndex.h"
+#include <algorithm>
+#include <mutex>
+
+// 순번이 새 블록에 들어서면 블록을 덧붙임 (샤드 순번은 연속이므로 중간 블록이 비는 일은 없음)
+void BlockFilter::add(uint64_t sequence, Time timestamp, std::string_view message) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    uint64_t number = sequence / BLOCK_ENTRIES;
+    if (blocks_.empty() || blocks_.back().number != number) {
+        blocks_.emplace_back();
+        blocks_.back().number = number;
+        blockCount_.store(blocks_.size(), std::memory_order_relaxed);
+    }
+    latest_ = sequence;
+    Block& block = blocks_.back();
+    block.live++;
+    block.minTime = std::min(block.minTime, timestamp);
+    block.maxTime = std::max(block.maxTime, timestamp);
+    uint32_t key = 0;
+    for (size_t i = 0; i < message.size(); ++i) {
+        key = TrigramIndex::nextKey(key, message[i]);
+        if (i < 2) continue;
+        uint64_t hash = hashOf(key);
+        for (int probe = 0; probe < PROBES; ++probe) {
+            size_t bit = bitOf(hash, probe);
+            block.bits[bit / 64] |= uint64_t(1) << (bit % 64);
+        }
+    }
+}
+
+// 블록 번호는 오름차순이므로 이진 탐색. 밀려남은 대부분 맨 앞 블록에서 일어남
+void BlockFilter::remove(uint64_t sequence) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    uint64_t number = sequence / BLOCK_ENTRIES;
+    auto it = std::lower_bound(blocks_.begin(), blocks_.end(), number,
+                               [](const Block& block, uint64_t value) { return block.number < value; });
+    if (it == blocks_.end() || it->number != number || --it->live > 0) return;
+    blocks_.erase(it);
+    blockCount_.store(blocks_.size(), std::memory_order_relaxed);
+}
+
+std::vector<uint64_t> BlockFilter::hashesOf(std::string_view literal) {
+    std::vector<uint64_t> hashes;
+    uint32_t key = 0;
+    for (size_t i = 0; i < literal.size(); ++i) {
+        key = TrigramIndex::nextKey(key, literal[i]);
+        if (i >= 2) hashes.push_back(hashOf(key));
+    }
+    return hashes;
+}
+
+bool BlockFilter::contains(const Block& block, const std::vector<uint64_t>& hashes) {
+    for (uint64_t hash : hashes) {
+        for (int probe = 0; probe < PROBES; ++probe) {
+            size_t bit = bitOf(hash, probe);
+            if (!(block.bits[bit / 64] & (uint64_t(1) << (bit % 64)))) return false;
+        }
+    }
+    return true;
+}
+
+// [SEQUENCE: CPP-MVP7-326]
+// 블록마다 시간 범위와 문자열 조건을 확인한 뒤 살아 있는 순번 범위로 펼침.
+// AND에서 짧은 문자열은 조건에서 빼고, OR에서는 하나라도 짧으면 좁힐 수 없음
+bool BlockFilter::candidates(const std::vector<std::string>& required, bool all, Time timeFrom, Time timeTo,
+                             size_t limit, std::vector<uint64_t>& out) const {
+    out.clear();
+    std::vector<std::vector<uint64_t>> literals;
+    for (const auto& literal : required) {
+        auto hashes = hashesOf(literal);
+        if (hashes.empty()) {
+            if (!all) return false;
+            continue;
+        }
+        literals.push_back(std::move(hashes));
+    }
+    if (literals.empty()) return false;
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const Block& block : blocks_) {
+        if (block.maxTime < timeFrom || block.minTime > timeTo) continue;
+        bool matched = all;
+        for (const auto& hashes : literals) {
+            if (contains(block, hashes) != all) {
+                matched = !all;
+                break;
+            }
+        }
+        if (!matched) continue;
+        uint64_t first = block.number * BLOCK_ENTRIES;
+        uint64_t last = std::min((block.number + 1) * BLOCK_ENTRIES, latest_ + 1);
+        for (uint64_t sequence = first; sequence < last; ++sequence) out.push_back(sequence);
+        if (out.size() > limit) return false;
+    }
+    return true;
+}
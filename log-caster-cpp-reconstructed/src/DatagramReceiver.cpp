@@ -0,0 +1,185 @@
+// [SEQUENCE: CPP-MVP7-110]
+#include "DatagramReceiver.h"
+#include "SyslogParser.h"
+#include "LineFramer.h"
+#include "LogServer.h"
+#include <stdexcept>
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include <poll.h>
+#include <arpa/inet.h>
+#include <sys/eventfd.h>
+
+// [SEQUENCE: CPP-MVP7-111]
+// 생성자: 종료 알림용 eventfd와 recvmmsg 벡터 준비
+DatagramReceiver::DatagramReceiver(LogServer* server, int fd, Format format, size_t shard)
+    : server_(server), fd_(fd), format_(format), shard_(shard), unixSocket_(false), wakeupFd_(-1), running_(true),
+      buffers_(BATCH_SIZE * DATAGRAM_SIZE), msgs_(BATCH_SIZE), iovecs_(BATCH_SIZE), peers_(BATCH_SIZE),
+      controls_(BATCH_SIZE * CMSG_SPACE(sizeof(ucred))), sampleCounter_(0) {
+    wakeupFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeupFd_ < 0) throw std::runtime_error("eventfd failed");
+
+    // [SEQUENCE: CPP-MVP7-128]
+    // AF_UNIX 소켓이면 데이터그램마다 송신자 자격 증명을 받도록 설정
+    sockaddr_storage local {};
+    socklen_t localLen = sizeof(local);
+    if (getsockname(fd_, reinterpret_cast<sockaddr*>(&local), &localLen) == 0 && local.ss_family == AF_UNIX) {
+        unixSocket_ = true;
+        int on = 1;
+        setsockopt(fd_, SOL_SOCKET, SO_PASSCRED, &on, sizeof(on));
+    }
+
+    // 순간적인 폭주에 대비해 커널 수신 버퍼 확대
+    int rcvbuf = RECV_BUFFER_BYTES;
+    setsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+
+    for (unsigned int i = 0; i < BATCH_SIZE; ++i) {
+        iovecs_[i].iov_base = &buffers_[i * DATAGRAM_SIZE];
+        iovecs_[i].iov_len = DATAGRAM_SIZE;
+        msgs_[i].msg_hdr = {};
+        msgs_[i].msg_hdr.msg_iov = &iovecs_[i];
+        msgs_[i].msg_hdr.msg_iovlen = 1;
+        if (unixSocket_) {
+            msgs_[i].msg_hdr.msg_control = &controls_[i * CMSG_SPACE(sizeof(ucred))];
+        } else {
+            msgs_[i].msg_hdr.msg_name = &peers_[i];
+        }
+    }
+    batch_.reserve(BATCH_SIZE);
+}
+
+DatagramReceiver::~DatagramReceiver() {
+    stop();
+    join();
+    close(wakeupFd_);
+}
+
+void DatagramReceiver::startThread() {
+    thread_ = std::thread([this] { run(); });
+}
+
+// 시그널 핸들러에서 호출 가능
+void DatagramReceiver::stop() {
+    running_ = false;
+    uint64_t one = 1;
+    ssize_t ignored = write(wakeupFd_, &one, sizeof(one));
+    (void)ignored;
+}
+
+void DatagramReceiver::join() {
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-112]
+// 수신 대기 루프: 읽을 수 있게 되면 소켓이 빌 때까지 묶음 단위로 수신
+// [SEQUENCE: CPP-MVP7-177]
+// BLOCK 정책으로 버퍼가 가득 차면 소켓은 감시하지 않고 여유가 생길 때까지 주기적으로 확인
+// (데이터그램에는 흐름 제어가 없으므로 넘치는 분량은 커널 수신 버퍼에서 버려짐)
+void DatagramReceiver::run() {
+    pollfd fds[2] = {{wakeupFd_, POLLIN, 0}, {fd_, POLLIN, 0}};
+    bool wasBlocked = false;
+    while (running_) {
+        bool isBlocked = blocked();
+        if (isBlocked && !wasBlocked) {
+            server_->logBuffer_->recordThrottle();
+        }
+        wasBlocked = isBlocked;
+
+        fds[1].revents = 0;
+        if (poll(fds, isBlocked ? 1 : 2, isBlocked ? RESUME_CHECK_MS : -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        if (fds[0].revents) break;
+        if (fds[1].revents & POLLIN) drain();
+    }
+}
+
+bool DatagramReceiver::blocked() const {
+    const auto& buffer = server_->logBuffer_;
+    return buffer->getOverflowPolicy() == LogBuffer::OverflowPolicy::BLOCK && !buffer->hasSpace(shard_);
+}
+
+// [SEQUENCE: CPP-MVP7-129]
+// 송신자 식별: UDP는 주소, AF_UNIX는 SCM_CREDENTIALS
+std::string DatagramReceiver::peerSource(unsigned int index) {
+    if (!unixSocket_) {
+        char peer[INET_ADDRSTRLEN];
+        inet_ntop(AF_INET, &peers_[index].sin_addr, peer, sizeof(peer));
+        return peer;
+    }
+    msghdr& hdr = msgs_[index].msg_hdr;
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(&hdr, cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_CREDENTIALS) {
+            ucred cred;
+            std::memcpy(&cred, CMSG_DATA(cmsg), sizeof(cred));
+            return LogServer::credentialSource(cred.pid, cred.uid);
+        }
+    }
+    return "unix";
+}
+
+// [SEQUENCE: CPP-MVP7-113]
+// recvmmsg 한 번에 최대 BATCH_SIZE개 수신 후 파싱한 묶음을 한 번에 커밋
+void DatagramReceiver::drain() {
+    RateLimiter* limiter = server_->rateLimiter_.get();
+    while (running_ && !blocked()) {
+        for (unsigned int i = 0; i < BATCH_SIZE; ++i) {
+            if (unixSocket_) {
+                msgs_[i].msg_hdr.msg_controllen = CMSG_SPACE(sizeof(ucred));
+            } else {
+                msgs_[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            }
+            msgs_[i].msg_hdr.msg_flags = 0;
+        }
+        int n = recvmmsg(fd_, msgs_.data(), BATCH_SIZE, MSG_DONTWAIT, nullptr);
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) continue;
+            break;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            size_t len = msgs_[i].msg_len;
+            if (len == 0) continue;
+            const char* data = static_cast<const char*>(iovecs_[i].iov_base);
+            std::string source = peerSource(static_cast<unsigned int>(i));
+            size_t first = batch_.size();
+
+            // [SEQUENCE: CPP-MVP7-130]
+            // 줄 단위 형식: 데이터그램 하나를 완결된 스트림 조각으로 보고 분리
+            if (format_ == Format::LINES) {
+                LineFramer framer(LogServer::SAFE_LOG_LENGTH);
+                framer.feed(data, len, lines_);
+                framer.flush(lines_);
+                for (auto& line : lines_) {
+                    batch_.emplace_back(std::move(line), "info", source);
+                }
+                lines_.clear();
+            } else {
+                batch_.push_back(SyslogParser::parse(data, len, source));
+
+                // [SEQUENCE: CPP-MVP5-3]
+                // 로그 메시지 크기 제한
+                std::string& message = batch_.back().message;
+                if (message.size() > LogServer::SAFE_LOG_LENGTH) {
+                    message.resize(LogServer::SAFE_LOG_LENGTH);
+                    message += "...";
+                }
+                if (message.empty()) batch_.pop_back();
+            }
+
+            // [SEQUENCE: CPP-MVP7-205]
+            // 출발지 한도 적용 (연결이 없으므로 출발지 버킷만, DELAY는 DROP으로 처리).
+            // AF_UNIX는 스트림 연결과 같은 "uid=N" 키를 사용
+            if (limiter) {
+                limiter->apply(nullptr, source.substr(0, source.find(',')), batch_, first, sampleCounter_, false);
+            }
+        }
+        server_->commitEntries(batch_, shard_);
+
+        if (static_cast<unsigned int>(n) < BATCH_SIZE) break;
+    }
+}
@@ -0,0 +1,186 @@
+// [SEQUENCE: CPP-MVP7-54]
+#include "EpollReactor.h"
+#include "LogServer.h"
+#include <stdexcept>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+// [SEQUENCE: CPP-MVP7-55]
+// 생성자: epoll 인스턴스와 종료 알림용 eventfd 생성
+EpollReactor::EpollReactor(LogServer* server, int id)
+    : Reactor(server, id), epollFd_(-1), wakeupFd_(-1) {
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd_ < 0) throw std::runtime_error("epoll_create1 failed");
+    wakeupFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeupFd_ < 0) {
+        close(epollFd_);
+        throw std::runtime_error("eventfd failed");
+    }
+    epoll_event ev {};
+    ev.events = EPOLLIN | EPOLLET;
+    ev.data.fd = wakeupFd_;
+    epoll_ctl(epollFd_, EPOLL_CTL_ADD, wakeupFd_, &ev);
+}
+
+// [SEQUENCE: CPP-MVP7-56]
+// 소멸자: 스레드 종료 후 남은 연결과 epoll 자원 정리
+EpollReactor::~EpollReactor() {
+    stop();
+    join();
+    closeAllConnections();
+    close(wakeupFd_);
+    close(epollFd_);
+}
+
+void EpollReactor::wake() {
+    uint64_t one = 1;
+    ssize_t ignored = write(wakeupFd_, &one, sizeof(one));
+    (void)ignored;
+}
+
+// [SEQUENCE: CPP-MVP7-26]
+// 리스너 등록 (리스너 소켓의 소유권은 LogServer에 있음)
+void EpollReactor::addListener(int fd, Protocol protocol) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags >= 0) fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+    epoll_event ev {};
+    ev.events = EPOLLIN | EPOLLET;
+    ev.data.fd = fd;
+    if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        throw std::runtime_error("epoll_ctl failed");
+    }
+    listeners_[fd] = protocol;
+}
+
+// [SEQUENCE: CPP-MVP7-29]
+// 엣지 트리거 이벤트 루프
+void EpollReactor::run() {
+    epoll_event events[MAX_EPOLL_EVENTS];
+    while (running_) {
+        // 멈춘 연결이 있으면 주기적으로 깨어나 버퍼 여유를 확인
+        int n = epoll_wait(epollFd_, events, MAX_EPOLL_EVENTS, resumeTimeoutMs());
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            log("epoll_wait error");
+            break;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == wakeupFd_) continue;
+
+            auto lit = listeners_.find(fd);
+            if (lit != listeners_.end()) {
+                handleAccept(fd, lit->second);
+                continue;
+            }
+            handleReadable(fd);
+        }
+        if (!paused_.empty()) {
+            resumePaused();
+        }
+
+        // 이번 반복에서 모든 연결로부터 읽은 메시지를 한 번에 전달
+        flushBatch();
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-30]
+// 엣지 트리거이므로 EAGAIN이 나올 때까지 accept
+void EpollReactor::handleAccept(int listenerFd, Protocol protocol) {
+    while (true) {
+        int client_fd = accept4(listenerFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client_fd < 0) {
+            if (errno == EINTR) continue;
+            return; // EAGAIN 또는 리스너 종료
+        }
+
+        if (!registerConnection(client_fd, client_fd, protocol)) {
+            close(client_fd);
+            continue;
+        }
+        epoll_event ev {};
+        ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+        ev.data.fd = client_fd;
+        if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, client_fd, &ev) < 0) {
+            releaseConnection(client_fd);
+        }
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-57]
+// 읽기 가능한 소켓을 EAGAIN까지 비움
+void EpollReactor::handleReadable(int fd) {
+    auto it = connections_.find(fd);
+    if (it == connections_.end()) return;
+    Connection& conn = *it->second;
+
+    char buffer[4096];
+    bool closed = false;
+    bool done = false;
+
+    while (true) {
+        // [SEQUENCE: CPP-MVP7-172]
+        // BLOCK 정책에서 버퍼가 가득 차거나 속도 제한 DELAY 중이면 소켓에 데이터를 남겨둔 채 멈춤
+        if (!conn.isQuery) {
+            if (paused_.count(fd)) return;
+            if (ingestBlocked()) {
+                throttleConnection(fd);
+                return;
+            }
+        }
+        ssize_t nbytes = recv(fd, buffer, sizeof(buffer), 0);
+        if (nbytes > 0) {
+            if (consume(conn, buffer, static_cast<size_t>(nbytes))) {
+                done = true;
+                break;
+            }
+            continue;
+        }
+        if (nbytes == 0) {
+            closed = true;
+            break;
+        }
+        if (errno == EINTR) continue;
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            closed = true;
+        }
+        break;
+    }
+
+    if (conn.isQuery && (done || closed)) {
+        epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+        dispatchQuery(fd);
+        return;
+    }
+    if (closed || done) {
+        closeConnection(fd);
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-173]
+// 엣지 트리거는 남은 데이터를 다시 알리지 않으므로 멈췄던 연결을 직접 읽음
+void EpollReactor::resumePaused() {
+    auto now = TokenBucket::Clock::now();
+    std::vector<uint64_t> ready;
+    for (uint64_t key : paused_) {
+        auto it = connections_.find(key);
+        if (it == connections_.end() || resumable(*it->second, now)) {
+            ready.push_back(key);
+        }
+    }
+    for (uint64_t key : ready) {
+        paused_.erase(key);
+        handleReadable(static_cast<int>(key));
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-58]
+// 연결을 epoll에서 제거하고 소켓을 닫음
+void EpollReactor::closeConnection(int fd) {
+    epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+    releaseConnection(fd);
+}
@@ -9,6 +9,8 @@
 const std::vector<IRCChannelManager::LogChannelConfig> IRCChannelManager::defaultLogChannels_ = {
     {"#logs-all", "*", "All log messages"},
     {"#logs-error", "ERROR", "Error level logs only"},
+    // [SEQUENCE: CPP-MVP7-158]
+    {"#logs-warning", "WARN", "Warning level logs only"},
 };
 
 IRCChannelManager::IRCChannelManager() {}
@@ -0,0 +1,125 @@
+// [SEQUENCE: CPP-MVP7-369]
+#include "KeywordAutomaton.h"
+#include "SubstringSearch.h"
+#include <algorithm>
+
+// 트라이를 만든 뒤 너비 우선으로 실패 링크를 구하면서, 없는 전이를 실패 상태의 전이로 채움.
+// 실패 상태는 더 얕아 먼저 처리되므로 그 행과 끝나는 키워드 목록은 이미 완성되어 있음
+KeywordAutomaton::KeywordAutomaton(const std::vector<std::string>& keywords) {
+    std::vector<std::string_view> unique;
+    for (const auto& keyword : keywords) {
+        if (std::find(unique.begin(), unique.end(), keyword) == unique.end()) unique.push_back(keyword);
+    }
+    keywordCount_ = unique.size();
+
+    uint16_t classes = 1;
+    for (std::string_view keyword : unique) {
+        if (!keyword.empty() && starts_.find(keyword[0]) == std::string::npos) starts_.push_back(keyword[0]);
+        for (unsigned char c : keyword) {
+            if (classOf_[c] == 0) classOf_[c] = classes++;
+        }
+    }
+    stride_ = classes;
+    skipRoot_ = !starts_.empty() && starts_.size() <= SubstringSearch::MAX_ANY_BYTES;
+
+    constexpr uint32_t NONE = UINT32_MAX;
+    std::vector<uint32_t> next(stride_, NONE);
+    std::vector<std::vector<uint32_t>> out(1);
+    for (uint32_t id = 0; id < unique.size(); ++id) {
+        if (unique[id].empty()) {
+            hasEmpty_ = true;
+            continue;
+        }
+        uint32_t state = 0;
+        for (unsigned char c : unique[id]) {
+            uint32_t& edge = next[state * stride_ + classOf_[c]];
+            if (edge == NONE) {
+                edge = static_cast<uint32_t>(out.size());
+                out.emplace_back();
+                next.resize(next.size() + stride_, NONE);
+            }
+            state = next[state * stride_ + classOf_[c]];
+        }
+        out[state].push_back(id);
+    }
+
+    size_t states = out.size();
+    std::vector<uint32_t> fail(states, 0);
+    std::vector<uint32_t> order;
+    order.reserve(states);
+    for (size_t column = 0; column < stride_; ++column) {
+        if (next[column] == NONE) {
+            next[column] = 0;
+        } else {
+            order.push_back(next[column]);
+        }
+    }
+    for (size_t k = 0; k < order.size(); ++k) {
+        uint32_t state = order[k];
+        const auto& inherited = out[fail[state]];
+        out[state].insert(out[state].end(), inherited.begin(), inherited.end());
+        for (size_t column = 0; column < stride_; ++column) {
+            uint32_t& edge = next[state * stride_ + column];
+            uint32_t fallback = next[fail[state] * stride_ + column];
+            if (edge == NONE) {
+                edge = fallback;
+            } else {
+                fail[edge] = fallback;
+                order.push_back(edge);
+            }
+        }
+    }
+
+    outStart_.reserve(states + 1);
+    outStart_.push_back(0);
+    for (const auto& ids : out) {
+        outIds_.insert(outIds_.end(), ids.begin(), ids.end());
+        outStart_.push_back(static_cast<uint32_t>(outIds_.size()));
+    }
+    delta_.resize(next.size());
+    for (size_t i = 0; i < next.size(); ++i) {
+        delta_[i] = next[i] * static_cast<uint32_t>(stride_) | (out[next[i]].empty() ? 0 : OUTPUT);
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-370]
+// 루트에서 키워드 첫 바이트가 아니면 다음 첫 바이트로 건너뜀.
+// OR는 끝나는 키워드가 있는 상태에 처음 들어서면 바로 참. AND는 새로 나온 키워드를 비트로 세다가
+// 모두 나오면 메시지 끝을 기다리지 않고 참
+bool KeywordAutomaton::matches(std::string_view text, bool all) const {
+    size_t found = hasEmpty_ ? 1 : 0;
+    if (found > 0 && (!all || found == keywordCount_)) return true;
+
+    std::array<uint64_t, INLINE_WORDS> inlineBits{};
+    std::vector<uint64_t> heapBits;
+    uint64_t* bits = inlineBits.data();
+    size_t words = (keywordCount_ + 63) / 64;
+    if (words > INLINE_WORDS) {
+        heapBits.assign(words, 0);
+        bits = heapBits.data();
+    }
+
+    uint32_t state = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        unsigned char c = text[i];
+        if (state == 0 && skipRoot_ && delta_[classOf_[c]] == 0) {
+            size_t at = SubstringSearch::findAnyOf(text.substr(i), starts_);
+            if (at == std::string_view::npos) return false;
+            i += at;
+            c = text[i];
+        }
+        uint32_t edge = delta_[state + classOf_[c]];
+        state = edge & ~OUTPUT;
+        if (!(edge & OUTPUT)) continue;
+        if (!all) return true;
+        size_t index = state / stride_;
+        for (uint32_t o = outStart_[index]; o < outStart_[index + 1]; ++o) {
+            uint32_t id = outIds_[o];
+            uint64_t bit = uint64_t(1) << (id % 64);
+            if (bits[id / 64] & bit) continue;
+            bits[id / 64] |= bit;
+            if (++found == keywordCount_) return true;
+        }
+    }
+    return false;
+}
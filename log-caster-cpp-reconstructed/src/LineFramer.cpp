@@ -0,0 +1,88 @@
+// [SEQUENCE: CPP-MVP7-81]
+#include "LineFramer.h"
+#include <cstring>
+
+LineFramer::LineFramer(size_t maxLineLength)
+    : maxLineLength_(maxLineLength), truncated_(false) {}
+
+// [SEQUENCE: CPP-MVP7-82]
+// 줄 경계 탐색은 memchr로 수행 (glibc 구현은 SIMD로 벡터화되어 있음).
+// 보관 중인 부분 줄이 없으면 수신 버퍼에서 바로 문자열을 만들어 복사를 한 번으로 줄인다.
+size_t LineFramer::feed(const char* data, size_t len, std::vector<std::string>& out) {
+    size_t emitted = 0;
+    const char* cur = data;
+    const char* end = data + len;
+
+    while (cur < end) {
+        const char* nl = static_cast<const char*>(std::memchr(cur, '\n', static_cast<size_t>(end - cur)));
+        if (!nl) {
+            appendPartial(cur, static_cast<size_t>(end - cur));
+            break;
+        }
+
+        size_t segment = static_cast<size_t>(nl - cur);
+        if (partial_.empty() && !truncated_) {
+            emitted += emit(cur, segment, false, out) ? 1 : 0;
+        } else {
+            appendPartial(cur, segment);
+            emitted += emit(partial_.data(), partial_.size(), truncated_, out) ? 1 : 0;
+            partial_.clear();
+            truncated_ = false;
+        }
+        cur = nl + 1;
+    }
+    return emitted;
+}
+
+// [SEQUENCE: CPP-MVP7-83]
+bool LineFramer::flush(std::vector<std::string>& out) {
+    if (partial_.empty()) return false;
+    bool emitted = emit(partial_.data(), partial_.size(), truncated_, out);
+    partial_.clear();
+    truncated_ = false;
+    return emitted;
+}
+
+// [SEQUENCE: CPP-MVP7-84]
+// 부분 줄은 최대 길이까지만 보관하고 나머지는 다음 '\n'까지 버림 (메모리 상한 보장)
+void LineFramer::appendPartial(const char* data, size_t len) {
+    size_t room = (partial_.size() < maxLineLength_) ? maxLineLength_ - partial_.size() : 0;
+    if (len > room) {
+        partial_.append(data, room);
+        truncated_ = true;
+    } else {
+        partial_.append(data, len);
+    }
+}
+
+// [SEQUENCE: CPP-MVP5-3]
+// 로그 메시지 크기 제한
+// [SEQUENCE: CPP-MVP7-85]
+// CRLF의 '\r'과 빈 줄은 제거하고, 긴 줄은 잘라서 "..."을 붙임
+bool LineFramer::emit(const char* data, size_t len, bool truncated, std::vector<std::string>& out) {
+    if (len > 0 && data[len - 1] == '\r') {
+        len--;
+    }
+    if (len == 0) return false;
+    if (len > maxLineLength_) {
+        len = maxLineLength_;
+        truncated = true;
+    }
+    out.emplace_back(data, len);
+    if (truncated) {
+        out.back() += "...";
+    }
+    return true;
+}
+
+// [SEQUENCE: CPP-MVP7-387]
+void LineFramer::flattenLineBreaks(std::string& text) {
+    if (text.find_first_of("\r\n") == std::string::npos) return;
+    size_t out = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        char c = text[i];
+        if (c == '\r' && i + 1 < text.size() && text[i + 1] == '\n') continue;
+        text[out++] = (c == '\r' || c == '\n') ? ' ' : c;
+    }
+    text.resize(out);
+}
@@ -1,25 +1,255 @@
 // [SEQUENCE: CPP-MVP2-17]
 #include "LogBuffer.h"
 #include "QueryParser.h"
+#include "SegmentStore.h"
+#include "SubstringSearch.h"
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <iterator>
+#include <functional>
+#include <queue>
+#include <thread>
+#include <exception>
+#include <limits>
+#include <ctime>
 
-LogBuffer::LogBuffer(size_t capacity) : capacity_(capacity) {}
+LogBuffer::LogBuffer(size_t byteBudget, size_t shards) : budget_(std::max<size_t>(1, byteBudget)) {
+    setShardCount(shards);
+}
+
+// [SEQUENCE: CPP-MVP7-164]
+const char* LogBuffer::policyName(OverflowPolicy policy) {
+    switch (policy) {
+        case OverflowPolicy::DROP_OLDEST: return "drop-oldest";
+        case OverflowPolicy::DROP_NEWEST: return "drop-newest";
+        case OverflowPolicy::BLOCK: return "block";
+        case OverflowPolicy::LEVEL_AWARE: return "level-aware";
+    }
+    return "unknown";
+}
+
+bool LogBuffer::parsePolicy(const std::string& name, OverflowPolicy& policy) {
+    for (auto candidate : {OverflowPolicy::DROP_OLDEST, OverflowPolicy::DROP_NEWEST,
+                           OverflowPolicy::BLOCK, OverflowPolicy::LEVEL_AWARE}) {
+        if (name == policyName(candidate)) {
+            policy = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+// [SEQUENCE: CPP-MVP7-332]
+const char* LogBuffer::indexModeName(IndexMode mode) {
+    switch (mode) {
+        case IndexMode::FULL: return "full";
+        case IndexMode::BLOOM: return "bloom";
+    }
+    return "unknown";
+}
+
+bool LogBuffer::parseIndexMode(const std::string& name, IndexMode& mode) {
+    for (auto candidate : {IndexMode::FULL, IndexMode::BLOOM}) {
+        if (name == indexModeName(candidate)) {
+            mode = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+int LogBuffer::levelRank(const std::string& level) {
+    if (level == "ERROR" || level == "FATAL") return 3;
+    if (level == "WARN" || level == "WARNING") return 2;
+    if (level == "DEBUG") return 0;
+    return 1;
+}
+
+void LogBuffer::setShardCount(size_t shards) {
+    shards = std::max<size_t>(1, shards);
+    if (shards == shards_.size()) return;
+    rebuild_(shards, budget_);
+}
+
+void LogBuffer::setByteBudget(size_t byteBudget) {
+    byteBudget = std::max<size_t>(1, byteBudget);
+    if (byteBudget == budget_) return;
+    rebuild_(shards_.size(), byteBudget);
+}
+
+// [SEQUENCE: CPP-MVP7-352]
+void LogBuffer::setQueryThreads(size_t threads) {
+    queryThreads_ = std::max<size_t>(1, threads);
+    queryPool_ = queryThreads_ > 1 ? std::make_unique<ThreadPool>(queryThreads_ - 1) : nullptr;
+}
+
+// 샤드를 새로 만들면 기존 항목이 append_를 거쳐 새 방식으로 색인됨
+void LogBuffer::setIndexMode(IndexMode mode) {
+    if (mode == indexMode_.load()) return;
+    indexMode_ = mode;
+    rebuild_(shards_.size(), budget_);
+}
+
+// [SEQUENCE: CPP-MVP7-224]
+// 예산은 샤드들에 고르게 나눔. 기존 항목은 시간 순으로 돌아가며 새 샤드에 넣어 각 샤드 안의 순서를 유지
+void LogBuffer::rebuild_(size_t shards, size_t budget) {
+
+    std::vector<LogEntry> existing;
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        const LogRing& ring = shards_[i]->ring;
+        for (size_t j = 0; j < ring.size(); ++j) {
+            existing.push_back(ring.entryAt(j));
+        }
+    }
+    std::stable_sort(existing.begin(), existing.end(),
+                     [](const LogEntry& a, const LogEntry& b) { return a.timestamp < b.timestamp; });
+
+    std::vector<std::unique_ptr<Shard>> created;
+    budget_ = budget;
+    size_t share = std::max<size_t>(1, budget_ / shards);
+    for (size_t i = 0; i < shards; ++i) {
+        created.push_back(std::make_unique<Shard>(i, share, dictionary_));
+    }
+    shards_.swap(created);
+    count_ = 0;
+    liveBytes_ = 0;
+    for (size_t i = 0; i < existing.size(); ++i) {
+        Shard& shard = *shards_[i % shards];
+        if (makeRoom_(shard, existing[i])) {
+            append_(shard, existing[i]);
+        }
+        shard.count = shard.ring.size();
+    }
+    for (const auto& shard : shards_) {
+        count_ += shard->ring.size();
+        updateBytes_(*shard);
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-262]
+// 샤드 락 보유 상태에서 호출. 샤드 수치의 변화량을 전체 합계에 반영하고 최대치를 갱신
+void LogBuffer::updateBytes_(Shard& shard) {
+    size_t live = shard.ring.liveBytes();
+    size_t before = shard.liveBytes.exchange(live, std::memory_order_relaxed);
+    shard.fragmentedBytes.store(shard.ring.fragmentedBytes(), std::memory_order_relaxed);
+    size_t total = live >= before ? liveBytes_.fetch_add(live - before) + (live - before)
+                                  : liveBytes_.fetch_sub(before - live) - (before - live);
+    size_t peak = peakBytes_.load(std::memory_order_relaxed);
+    while (total > peak && !peakBytes_.compare_exchange_weak(peak, total, std::memory_order_relaxed)) {
+    }
+}
+
+LogBuffer::Shard& LogBuffer::shardFor_(size_t shard) {
+    if (shard == ANY_SHARD) {
+        shard = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    }
+    return *shards_[shard % shards_.size()];
+}
+
+bool LogBuffer::hasSpace(size_t shard, size_t inflight) const {
+    const Shard& target = *shards_[shard % shards_.size()];
+    size_t inflightBytes = inflight * (LogRing::SLOT_BYTES + EXPECTED_MESSAGE_BYTES);
+    return target.count.load(std::memory_order_relaxed) + inflight < target.ring.capacity() &&
+           target.liveBytes.load(std::memory_order_relaxed) + inflightBytes < target.ring.reservedBytes();
+}
+
+// [SEQUENCE: CPP-MVP7-165]
+// 정책 변경. LEVEL_AWARE로 바뀌면 현재 내용으로 레벨별 수를 다시 계산
+void LogBuffer::setOverflowPolicy(OverflowPolicy policy) {
+    for (auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        policy_ = policy;
+        recountLevels_(*shard);
+    }
+}
+
+void LogBuffer::recountLevels_(Shard& shard) {
+    std::fill(std::begin(shard.levelCounts), std::end(shard.levelCounts), 0);
+    std::fill(std::begin(shard.levelCursors), std::end(shard.levelCursors), 0);
+    if (policy_.load(std::memory_order_relaxed) != OverflowPolicy::LEVEL_AWARE) return;
+    for (size_t i = 0; i < shard.ring.size(); ++i) {
+        shard.levelCounts[shard.ring.levelAt(i)]++;
+    }
+}
 
 // [SEQUENCE: CPP-MVP6-6]
 void LogBuffer::push(std::string message, const std::string& level, const std::string& source) {
-    LogEntry entry(std::move(message), level, source);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (buffer_.size() >= capacity_) {
-        dropOldest_();
+    std::vector<LogEntry> entries;
+    entries.emplace_back(std::move(message), level, source);
+    pushBatch(entries);
+}
+
+// [SEQUENCE: CPP-MVP7-93]
+// 배치 삽입: 넘치는 만큼 앞에서 한 번에 제거한 뒤 뒤에 이어 붙임
+// [SEQUENCE: CPP-MVP7-217]
+// 항목은 링 슬롯으로 복사되며, 넘겨받은 벡터의 문자열은 호출자가 재사용하거나 해제
+// [SEQUENCE: CPP-MVP7-225]
+// 채널 콜백은 샤드 락 밖에서 먼저 호출하고, 샤드 락은 저장하는 동안만 보유
+void LogBuffer::pushBatch(std::vector<LogEntry>& entries, size_t shardHint) {
+    if (entries.empty()) return;
+    for (const auto& entry : entries) {
+        notifyCallbacks_(entry);
     }
-    buffer_.push_back(entry);
-    totalLogs_++;
+    totalLogs_ += entries.size();
 
-    // Notify callbacks
+    Shard& shard = shardFor_(shardHint);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    size_t before = shard.ring.size();
+
+    // 배치 자체가 샤드 용량보다 크면 DROP_OLDEST에서는 앞부분을 버퍼에 넣지 않음
+    // [SEQUENCE: CPP-MVP7-166]
+    // 그 외 정책은 항목마다 정책에 따라 자리를 확보 (락은 여전히 한 번)
+    size_t skip = 0;
+    if (policy_ == OverflowPolicy::DROP_OLDEST && entries.size() > shard.ring.capacity()) {
+        skip = entries.size() - shard.ring.capacity();
+        droppedLogs_ += skip;
+        droppedOldest_ += skip;
+        if (spill_) {
+            for (size_t i = 0; i < skip; ++i) {
+                const LogEntry& entry = entries[i];
+                LogRing::Record record{entry.timestamp.time_since_epoch().count(), 0, 0, 0,
+                                       dictionary_.intern(entry.source), dictionary_.intern(entry.category),
+                                       levelRank(entry.level), entry.message};
+                spill_->append(shard.index, record, SegmentStore::DETACHED);
+            }
+        }
+    }
+    for (size_t i = skip; i < entries.size(); ++i) {
+        if (makeRoom_(shard, entries[i])) {
+            append_(shard, entries[i]);
+        }
+    }
+    entries.clear();
+
+    size_t after = shard.ring.size();
+    shard.count = after;
+    updateBytes_(shard);
+    if (after >= before) {
+        count_ += after - before;
+    } else {
+        count_ -= before - after;
+    }
+}
+
+void LogBuffer::pushBatch(std::vector<std::string>& messages, const std::string& level, const std::string& source) {
+    // LogEntry 생성(타임스탬프 포함)은 락 밖에서 수행
+    std::vector<LogEntry> entries;
+    entries.reserve(messages.size());
+    for (auto& message : messages) {
+        entries.emplace_back(std::move(message), level, source);
+    }
+    messages.clear();
+    pushBatch(entries);
+}
+
+// [SEQUENCE: CPP-MVP7-94]
+// 채널 콜백 호출
+void LogBuffer::notifyCallbacks_(const LogEntry& entry) {
+    std::shared_lock<std::shared_mutex> lock(callbacksMutex_);
     for (auto const& [channel, callbacks] : callbacks_) {
         // Simple matching for now
-        if (channel == "#logs-all" || (channel == "#logs-error" && level == "ERROR")) {
+        if (channel == "#logs-all" || (channel == "#logs-error" && entry.level == "ERROR")) {
             for (const auto& callback : callbacks) {
                 callback(entry);
             }
@@ -27,54 +257,393 @@ void LogBuffer::push(std::string message, const std::string& level, const std::s
     }
 }
 
-void LogBuffer::dropOldest_() {
-    if (!buffer_.empty()) {
-        buffer_.pop_front();
+// [SEQUENCE: CPP-MVP7-280]
+// 디스크 계층이 있으면 링에서 떼기 전에 기록 (읽기 측이 링에서 사라진 것을 본 시점에는 이미 기록되어 있음)
+void LogBuffer::dropOldest_(Shard& shard) {
+    if (!shard.ring.empty()) {
+        std::string scratch;
+        LogRing::Record record = shard.ring.recordAt(0, scratch);
+        if (spill_) {
+            spill_->append(shard.index, record, SegmentStore::POPPED);
+        }
+        // 색인에서 빼기 전에 링 머리를 옮김. 거꾸로면 그 사이 후보를 고른 검색이 이 항목을 후보에서 놓치고도
+        // 링 머리 뒤에 있다고 보아 디스크 계층에서도 빼게 됨 (메시지 바이트는 다음 push 전까지 그대로)
+        shard.ring.popFront();
+        shiftLevelCursors_(shard, 0);
+        if (indexMode_.load(std::memory_order_relaxed) == IndexMode::BLOOM) {
+            shard.blocks.remove(record.sequence);
+        } else {
+            shard.tokens.remove(record.sequence, record.message);
+            shard.trigrams.evict(record.sequence);
+        }
         droppedLogs_++;
+        droppedOldest_++;
     }
 }
 
-std::vector<std::string> LogBuffer::search(const std::string& keyword) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::vector<std::string> results;
-    for (const auto& entry : buffer_) {
-        if (entry.message.find(keyword) != std::string::npos) {
-            auto time_t = std::chrono::system_clock::to_time_t(entry.timestamp);
-            std::stringstream ss;
-            ss << "[" << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S") << "] ";
-            ss << entry.message;
-            results.push_back(ss.str());
+// [SEQUENCE: CPP-MVP7-167]
+// 정책에 따라 항목 하나가 들어갈 자리를 만듦. false면 새 항목을 버림
+// [SEQUENCE: CPP-MVP7-218]
+// 슬롯 수와 아레나 바이트가 모두 남아야 자리가 있는 것으로 보고, 생길 때까지 정책을 반복 적용
+bool LogBuffer::makeRoom_(Shard& shard, const LogEntry& entry) {
+    while (!shard.ring.hasRoom(entry)) {
+        switch (policy_.load(std::memory_order_relaxed)) {
+            case OverflowPolicy::DROP_OLDEST:
+                dropOldest_(shard);
+                break;
+            case OverflowPolicy::DROP_NEWEST:
+                droppedLogs_++;
+                droppedNewest_++;
+                return false;
+            case OverflowPolicy::BLOCK:
+                // 수집 측이 hasSpace()로 읽기를 멈추지만 링은 늘어날 수 없으므로,
+                // 멈추기 전에 이미 읽은 분량이 넘치면 가장 오래된 항목을 밀어냄
+                dropOldest_(shard);
+                break;
+            case OverflowPolicy::LEVEL_AWARE:
+                if (shedLowerLevel_(shard, levelRank(entry.level))) break;
+                droppedLogs_++;
+                shedLogs_++;
+                return false;
         }
     }
-    return results;
+    return true;
 }
 
-std::vector<std::string> LogBuffer::searchEnhanced(const ParsedQuery& query) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    std::vector<std::string> results;
-    for (const auto& entry : buffer_) {
-        if (query.matches(entry.message, entry.timestamp)) {
-            auto time_t = std::chrono::system_clock::to_time_t(entry.timestamp);
-            std::stringstream ss;
-            ss << "[" << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S") << "] ";
-            ss << entry.message;
-            results.push_back(ss.str());
+// [SEQUENCE: CPP-MVP7-168]
+// rank보다 낮은 레벨 중 가장 낮은 레벨의 가장 오래된 항목 제거
+// [SEQUENCE: CPP-MVP7-392]
+// 레벨 커서부터 훑으므로 커서가 지나간 항목은 다시 보지 않음 (훑는 양은 밀려난 항목 수만큼으로 상각됨)
+bool LogBuffer::shedLowerLevel_(Shard& shard, int rank) {
+    for (int victim = 0; victim < rank; ++victim) {
+        if (shard.levelCounts[victim] == 0) continue;
+        for (size_t i = shard.levelCursors[victim]; i < shard.ring.size(); ++i) {
+            if (shard.ring.levelAt(i) == victim) {
+                std::string scratch;
+                LogRing::Record record = shard.ring.recordAt(i, scratch);
+                // 맨 앞 항목은 세대를 올리지 않고 머리만 옮기므로 밀려난 항목과 같이 기록
+                if (spill_) {
+                    spill_->append(shard.index, record, i == 0 ? SegmentStore::POPPED : SegmentStore::ERASED);
+                }
+                shard.ring.erase(i);
+                shiftLevelCursors_(shard, i);
+                shard.levelCursors[victim] = i;
+                if (indexMode_.load(std::memory_order_relaxed) == IndexMode::BLOOM) {
+                    shard.blocks.remove(record.sequence);
+                } else {
+                    shard.tokens.remove(record.sequence, record.message);
+                    // 3글자 색인은 블록 단위라 중간 항목은 블록에 남겨 두고, 맨 앞 항목일 때만 밀려난 것으로 알림
+                    if (i == 0) shard.trigrams.evict(record.sequence);
+                }
+                shard.levelCounts[victim]--;
+                droppedLogs_++;
+                shedLogs_++;
+                return true;
+            }
         }
     }
+    return false;
+}
+
+// 중간 제거는 앞쪽 항목의 순번을 그대로 두고 뒤쪽 항목만 한 칸씩 당김 (링이 어느 쪽 슬롯을 옮기든 같음)
+void LogBuffer::shiftLevelCursors_(Shard& shard, size_t index) {
+    for (size_t& cursor : shard.levelCursors) {
+        if (cursor > index) cursor--;
+    }
+}
+
+void LogBuffer::append_(Shard& shard, const LogEntry& entry) {
+    if (policy_.load(std::memory_order_relaxed) == OverflowPolicy::LEVEL_AWARE) {
+        shard.levelCounts[levelRank(entry.level)]++;
+    }
+    shard.ring.push(entry);
+    // 링에 저장된(아레나보다 길면 잘린) 메시지로 색인해야 밀려날 때 같은 토큰을 지움
+    std::string scratch;
+    LogRing::Record record = shard.ring.recordAt(shard.ring.size() - 1, scratch);
+    if (indexMode_.load(std::memory_order_relaxed) == IndexMode::BLOOM) {
+        shard.blocks.add(record.sequence, record.timestamp, record.message);
+        return;
+    }
+    shard.tokens.add(record.sequence, record.message);
+    shard.trigrams.add(record.sequence, record.message);
+}
+
+// [SEQUENCE: CPP-MVP7-226]
+// 샤드마다 일치 항목의 시각과 메시지만 복사한 뒤 k-way 병합과 형식화
+// [SEQUENCE: CPP-MVP7-234]
+// 샤드는 락 없이 읽고, 중간 제거/압축이 겹쳐 일관된 결과를 못 얻은 경우에만 생산자 락을 잡고 다시 읽음
+// [SEQUENCE: CPP-MVP7-305]
+// 역색인 후보가 샤드 항목의 1/4을 넘으면 후보마다 위치를 찾는 것보다 열을 훑는 편이 빠르므로 전체 훑기
+// [SEQUENCE: CPP-MVP7-320]
+// 키워드는 토큰 색인으로 먼저 좁히고, 못 좁히면(식별자 조각, 긴 숫자) 3글자 색인으로 좁힘.
+// 정규식 고정 문자열의 3글자 후보는 키워드 후보와 교집합
+// [SEQUENCE: CPP-MVP7-333]
+// BLOOM 방식은 두 색인 대신 블록 필터로 같은 순서를 따름
+bool LogBuffer::candidates_(const Shard& shard, const LogRing::Filter& filter, const TextTerms& terms,
+                            std::vector<uint64_t>& sequences) const {
+    size_t limit = shard.ring.size() / 4;
+    bool bloom = indexMode_.load(std::memory_order_relaxed) == IndexMode::BLOOM;
+    auto select = [&](const std::vector<std::string>& required, bool all, bool tokens, std::vector<uint64_t>& out) {
+        if (required.empty()) return false;
+        if (bloom) return shard.blocks.candidates(required, all, filter.timeFrom, filter.timeTo, limit, out);
+        return (tokens && shard.tokens.candidates(required, all, limit, out)) ||
+               shard.trigrams.candidates(required, all, limit, out);
+    };
+    bool narrowed = select(terms.keywords, terms.all, true, sequences);
+    std::vector<uint64_t> literal;
+    if (select(terms.literals, true, false, literal)) {
+        if (narrowed) {
+            std::vector<uint64_t> both;
+            std::set_intersection(sequences.begin(), sequences.end(), literal.begin(), literal.end(),
+                                  std::back_inserter(both));
+            sequences.swap(both);
+        } else {
+            sequences.swap(literal);
+        }
+        narrowed = true;
+    }
+    return narrowed;
+}
+
+template <typename Predicate>
+std::vector<std::string> LogBuffer::collect_(const LogRing::Filter& filter, const TextTerms& terms,
+                                             Predicate matches, size_t limit) const {
+    using Match = std::pair<std::chrono::system_clock::time_point, std::string>;
+    auto visit = [&matches](const std::chrono::system_clock::time_point& timestamp, std::string_view message) {
+        return matches(message, timestamp);
+    };
+    size_t shardCount = shards_.size();
+    std::vector<std::vector<Match>> runs(shardCount);
+    std::vector<LogRing::ScanState> states(shardCount);
+    std::vector<std::vector<uint64_t>> sequences(shardCount);
+    std::vector<LogRing::Filter> shardFilters(shardCount, filter);
+
+    // [SEQUENCE: CPP-MVP7-349]
+    // 샤드(큰 샤드는 위치 범위)마다 한 조각. rank는 샤드 안에서 최신 범위가 0이며, rank 순으로 훑어
+    // limit가 있으면 최신 항목부터 채워짐
+    struct Part {
+        size_t shard;
+        size_t rank;
+        LogRing::Filter filter;
+        std::vector<Match> run;
+        LogRing::ScanState state;
+        bool consistent = false;
+        bool done = false;
+    };
+    std::vector<Part> parts;
+    for (size_t i = 0; i < shardCount; ++i) {
+        const Shard& shard = *shards_[i];
+        if (candidates_(shard, filter, terms, sequences[i])) {
+            shardFilters[i].sequences = &sequences[i];
+        }
+        std::vector<std::pair<uint64_t, uint64_t>> ranges{{0, std::numeric_limits<uint64_t>::max()}};
+        if (queryPool_ && !shardFilters[i].sequences && shard.ring.size() >= PARALLEL_MIN_ENTRIES) {
+            ranges = shard.ring.partition(queryThreads_ * (limit != NO_LIMIT ? LIMIT_SPLIT : 1));
+        }
+        for (size_t r = 0; r < ranges.size(); ++r) {
+            Part part{i, ranges.size() - 1 - r, shardFilters[i], {}, {}};
+            part.filter.fromPos = ranges[r].first;
+            part.filter.toPos = ranges[r].second;
+            parts.push_back(std::move(part));
+        }
+    }
+    std::vector<Part*> order;
+    for (auto& part : parts) order.push_back(&part);
+    std::stable_sort(order.begin(), order.end(), [](const Part* a, const Part* b) { return a->rank < b->rank; });
+
+    // [SEQUENCE: CPP-MVP7-350]
+    // 조각 묶음마다 호출 스레드가 첫 조각을 맡고 나머지는 작업자에게 넘김. 예외(정규식 복잡도 초과 등)는
+    // 넘긴 조각이 모두 끝난 뒤에 다시 던짐. limit가 있으면 스레드 수만큼씩 훑고, 최신 범위들에서 limit개를
+    // 채운 샤드는 남은(더 오래된) 범위를 건너뜀
+    auto scanPart = [this, &visit](Part* part) {
+        part->consistent = shards_[part->shard]->ring.scan(part->filter, visit, part->run, &part->state);
+        part->done = true;
+    };
+    std::vector<size_t> found(shardCount, 0);
+    std::vector<bool> satisfied(shardCount, false);
+    size_t wave = limit != NO_LIMIT ? queryThreads_ : order.size();
+    for (size_t next = 0; next < order.size();) {
+        std::vector<Part*> batch;
+        while (next < order.size() && batch.size() < wave) {
+            Part* part = order[next++];
+            if (!satisfied[part->shard]) batch.push_back(part);
+        }
+        std::vector<std::future<void>> pending;
+        std::exception_ptr error;
+        try {
+            for (size_t k = 1; k < batch.size(); ++k) {
+                if (queryPool_) {
+                    pending.push_back(queryPool_->enqueue(scanPart, batch[k]));
+                } else {
+                    scanPart(batch[k]);
+                }
+            }
+            if (!batch.empty()) scanPart(batch[0]);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        for (auto& task : pending) {
+            try {
+                task.get();
+            } catch (...) {
+                if (!error) error = std::current_exception();
+            }
+        }
+        if (error) std::rethrow_exception(error);
+        if (limit == NO_LIMIT) continue;
+        for (const Part* part : batch) {
+            found[part->shard] += part->run.size();
+            if (found[part->shard] >= limit) satisfied[part->shard] = true;
+        }
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < shardCount; ++i) {
+        const Shard& shard = *shards_[i];
+        // 훑은 조각(최신 쪽 연속 범위)이 모두 같은 세대에서 일관되면 위치 순으로 이어 한 번의 훑기로 봄
+        std::vector<Part*> done;
+        for (auto& part : parts) {
+            if (part.shard == i && part.done) done.push_back(&part);
+        }
+        bool consistent = !done.empty();
+        for (const Part* part : done) {
+            consistent = consistent && part->consistent && part->state.generation == done[0]->state.generation;
+        }
+        if (consistent) {
+            states[i] = std::move(done[0]->state);
+            runs[i] = std::move(done[0]->run);
+            for (size_t k = 1; k < done.size(); ++k) {
+                LogRing::ScanState& state = done[k]->state;
+                states[i].examined.insert(states[i].examined.end(), state.examined.begin(), state.examined.end());
+                states[i].frontier = std::max(states[i].frontier, state.frontier);
+                std::move(done[k]->run.begin(), done[k]->run.end(), std::back_inserter(runs[i]));
+            }
+        } else {
+            // [SEQUENCE: CPP-MVP7-340]
+            // 중간 제거/압축이 겹치면 본문 검사 없이 열 조건을 통과한 항목만 사본으로 고정한 뒤 사본에서 본문을 검사.
+            // 복사는 정규식 검사보다 훨씬 짧아 락 없이 성공하기 쉽고, 끝내 락을 잡아도 생산자는 복사하는 동안만 기다림
+            runs[i].clear();
+            std::vector<Match> pinned;
+            auto pin = [](const std::chrono::system_clock::time_point&, std::string_view) { return true; };
+            for (int attempt = 1; attempt < LOCK_FREE_SCAN_ATTEMPTS && !consistent; ++attempt) {
+                consistent = shard.ring.scan(shardFilters[i], pin, pinned, &states[i]);
+            }
+            if (!consistent) {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard.ring.scan(shardFilters[i], pin, pinned, &states[i]);
+            }
+            for (auto& match : pinned) {
+                if (matches(match.second, match.first)) runs[i].push_back(std::move(match));
+            }
+        }
+        total += runs[i].size();
+    }
+    // [SEQUENCE: CPP-MVP7-281]
+    // 디스크 계층은 링 훑기가 확인하지 못한 항목만 더해 한 번씩만 세고, 시간 순으로 정렬해 병합에 넣음
+    // [SEQUENCE: CPP-MVP7-351]
+    // limit를 채운 샤드는 링에서 남긴 가장 오래된 일치 시각보다 이른 레코드가 결과에 들 수 없으므로 빼고,
+    // 모든 샤드가 채워졌으면 그 시각들 중 가장 이른 시각 이전의 세그먼트는 통째로 건너뜀
+    if (spill_) {
+        std::vector<std::chrono::system_clock::rep> cutoff(shardCount, std::numeric_limits<std::chrono::system_clock::rep>::min());
+        LogRing::Filter spillFilter = filter;
+        bool allSatisfied = true;
+        auto earliest = std::numeric_limits<std::chrono::system_clock::rep>::max();
+        for (size_t i = 0; i < shardCount; ++i) {
+            if (!satisfied[i] || runs[i].size() < limit) {
+                allSatisfied = false;
+                continue;
+            }
+            cutoff[i] = runs[i][runs[i].size() - limit].first.time_since_epoch().count();
+            earliest = std::min(earliest, cutoff[i]);
+        }
+        if (allSatisfied && limit != NO_LIMIT) spillFilter.timeFrom = std::max(spillFilter.timeFrom, earliest);
+        runs.emplace_back();
+        spill_->scan(spillFilter, [&states, &cutoff](const SegmentStore::RecordHeader& header) {
+            if (header.shard < cutoff.size() && header.timestamp < cutoff[header.shard]) return false;
+            return SegmentStore::missedBy(header, states);
+        }, visit, runs.back());
+        std::stable_sort(runs.back().begin(), runs.back().end(),
+                         [](const Match& a, const Match& b) { return a.first < b.first; });
+        total += runs.back().size();
+    }
+
+    // (시각, 샤드, 위치) 최소 힙으로 샤드별 결과를 시간 순으로 병합. limit가 있으면 앞쪽(오래된) 결과는 형식화하지 않음
+    using Cursor = std::pair<std::chrono::system_clock::time_point, std::pair<size_t, size_t>>;
+    std::priority_queue<Cursor, std::vector<Cursor>, std::greater<Cursor>> heap;
+    for (size_t i = 0; i < runs.size(); ++i) {
+        if (!runs[i].empty()) heap.push({runs[i][0].first, {i, 0}});
+    }
+    size_t skip = limit != NO_LIMIT && total > limit ? total - limit : 0;
+    std::vector<std::string> results;
+    results.reserve(total - skip);
+    for (size_t emitted = 0; !heap.empty(); ++emitted) {
+        auto [run, pos] = heap.top().second;
+        heap.pop();
+        if (pos + 1 < runs[run].size()) heap.push({runs[run][pos + 1].first, {run, pos + 1}});
+        if (emitted < skip) continue;
+        const Match& match = runs[run][pos];
+        auto time_t = std::chrono::system_clock::to_time_t(match.first);
+        // [SEQUENCE: CPP-MVP7-398]
+        // 여러 검색 스레드가 동시에 형식화하므로 정적 버퍼를 쓰는 localtime 대신 localtime_r
+        std::tm local{};
+        localtime_r(&time_t, &local);
+        std::stringstream ss;
+        ss << "[" << std::put_time(&local, "%Y-%m-%d %H:%M:%S") << "] ";
+        ss << match.second;
+        results.push_back(ss.str());
+    }
     return results;
 }
 
+// [SEQUENCE: CPP-MVP7-363]
+std::vector<std::string> LogBuffer::search(const std::string& keyword) const {
+    return collect_(LogRing::Filter{}, TextTerms{{keyword}, true, {}}, [&keyword](std::string_view message, const std::chrono::system_clock::time_point&) {
+        return SubstringSearch::contains(message, keyword);
+    });
+}
+
+// [SEQUENCE: CPP-MVP7-245]
+// 시각/레벨/출처 조건은 열 필터로 넘기고, 본문 조건만 메시지마다 검사.
+// 사전에 없는 source/category를 찾으면 일치하는 항목이 있을 수 없음
+std::vector<std::string> LogBuffer::searchEnhanced(const ParsedQuery& query) const {
+    LogRing::Filter filter;
+    if (query.timeFrom()) filter.timeFrom = query.timeFrom()->time_since_epoch().count();
+    if (query.timeTo()) filter.timeTo = query.timeTo()->time_since_epoch().count();
+    if (query.level()) filter.level = *query.level();
+    if (query.source()) {
+        filter.source = dictionary_.find(*query.source());
+        if (filter.source == StringDictionary::NONE) return {};
+    }
+    if (query.category()) {
+        filter.category = dictionary_.find(*query.category());
+        if (filter.category == StringDictionary::NONE) return {};
+    }
+    TextTerms terms{query.keywords(), query.op() == OperatorType::AND, query.regexLiterals()};
+    return collect_(filter, terms, [&query](std::string_view message, const std::chrono::system_clock::time_point&) {
+        return query.matchesText(message);
+    }, query.limit().value_or(NO_LIMIT));
+}
+
 // [SEQUENCE: CPP-MVP6-8]
 void LogBuffer::registerCallback(const std::string& channel, LogCallback callback) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(callbacksMutex_);
     callbacks_[channel].push_back(callback);
 }
 
 size_t LogBuffer::size() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return buffer_.size();
+    return count_.load();
 }
 
 LogBuffer::StatsSnapshot LogBuffer::getStats() const {
-    return { totalLogs_.load(), droppedLogs_.load() };
+    uint64_t fragmented = 0, indexTerms = 0, indexTrigrams = 0, indexBlocks = 0, indexBytes = 0;
+    for (const auto& shard : shards_) {
+        fragmented += shard->fragmentedBytes.load(std::memory_order_relaxed);
+        indexTerms += shard->tokens.termCount();
+        indexTrigrams += shard->trigrams.trigramCount();
+        indexBlocks += shard->blocks.blockCount();
+        indexBytes += shard->tokens.bytes() + shard->trigrams.bytes() + shard->blocks.bytes();
+    }
+    return { totalLogs_.load(), droppedLogs_.load(),
+             droppedOldest_.load(), droppedNewest_.load(), shedLogs_.load(), throttledLogs_.load(),
+             budget_, liveBytes_.load(), peakBytes_.load(), fragmented, indexTerms, indexTrigrams, indexBlocks, indexBytes };
 }
\ No newline at end of file
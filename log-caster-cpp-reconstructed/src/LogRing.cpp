@@ -0,0 +1,356 @@
+// [SEQUENCE: CPP-MVP7-210]
+#include "LogRing.h"
+#include "LogBuffer.h"
+#include <algorithm>
+#include <cstring>
+
+// 아레나는 기본 초기화로 할당하여 실제로 쓰인 페이지만 상주 메모리가 됨
+LogRing::LogRing(size_t capacity, size_t arenaBytes, StringDictionary& dictionary)
+    : capacity_(std::max<size_t>(1, capacity)), dictionary_(dictionary),
+      seqs_(new std::atomic<uint64_t>[capacity_]), timestamps_(capacity_), levels_(capacity_),
+      sources_(capacity_), categories_(capacity_), bytePos_(capacity_), lengths_(capacity_),
+      sequences_(capacity_), levelNames_(capacity_), extraLengths_(capacity_),
+      bucketCount_(bucketsFor(capacity_)), bucketIds_(new std::atomic<uint64_t>[bucketCount_]),
+      bucketMin_(new std::atomic<Clock::rep>[bucketCount_]), bucketMax_(new std::atomic<Clock::rep>[bucketCount_]),
+      arena_(new uint64_t[(std::max<size_t>(1, arenaBytes) + sizeof(uint64_t) - 1) / sizeof(uint64_t)]),
+      arenaSize_(std::max<size_t>(1, arenaBytes)) {
+    for (size_t i = 0; i < capacity_; ++i) {
+        seqs_[i].store(0, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < bucketCount_; ++i) {
+        bucketIds_[i].store(UINT64_MAX, std::memory_order_relaxed);
+        bucketMin_[i].store(0, std::memory_order_relaxed);
+        bucketMax_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-294]
+// 새 버킷은 범위를 먼저 쓰고 번호를 release로 게시, 기존 버킷은 범위만 넓힘
+void LogRing::indexTimestamp(uint64_t pos, Clock::rep timestamp) {
+    uint64_t bucket = pos / TIME_BUCKET_SLOTS;
+    size_t index = static_cast<size_t>(bucket % bucketCount_);
+    if (bucketIds_[index].load(std::memory_order_relaxed) != bucket) {
+        bucketIds_[index].store(UINT64_MAX, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bucketMin_[index].store(timestamp, std::memory_order_relaxed);
+        bucketMax_[index].store(timestamp, std::memory_order_relaxed);
+        bucketIds_[index].store(bucket, std::memory_order_release);
+        return;
+    }
+    if (timestamp < bucketMin_[index].load(std::memory_order_relaxed)) {
+        bucketMin_[index].store(timestamp, std::memory_order_relaxed);
+    }
+    if (timestamp > bucketMax_[index].load(std::memory_order_relaxed)) {
+        bucketMax_[index].store(timestamp, std::memory_order_relaxed);
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-259]
+// 메타데이터는 (키 길이, 키, 값 길이, 값) 순서로 메시지 바로 뒤에 직렬화
+namespace {
+size_t metadataBytes(const LogEntry& entry) {
+    size_t bytes = 0;
+    for (const auto& [key, value] : entry.metadata) {
+        bytes += 2 * sizeof(uint32_t) + key.size() + value.size();
+    }
+    return bytes;
+}
+
+void appendField(std::string& out, const std::string& field) {
+    uint32_t length = static_cast<uint32_t>(field.size());
+    out.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    out.append(field);
+}
+
+bool readField(std::string_view& in, std::string& field) {
+    uint32_t length;
+    if (in.size() < sizeof(length)) return false;
+    std::memcpy(&length, in.data(), sizeof(length));
+    in.remove_prefix(sizeof(length));
+    if (in.size() < length) return false;
+    field.assign(in.data(), length);
+    in.remove_prefix(length);
+    return true;
+}
+}
+
+std::pair<size_t, size_t> LogRing::spanOf(const LogEntry& entry) const {
+    size_t length = std::min(entry.message.size(), arenaSize_);
+    size_t extra = metadataBytes(entry);
+    if (length + extra > arenaSize_) extra = 0;
+    return {length, extra};
+}
+
+bool LogRing::hasRoom(const LogEntry& entry) const {
+    auto [length, extra] = spanOf(entry);
+    return size() < capacity_ && arenaUsed_ + length + extra <= arenaSize_;
+}
+
+size_t LogRing::fragmentedBytes() const {
+    uint64_t head = headPos_.load(std::memory_order_relaxed);
+    if (head == tailPos_.load(std::memory_order_relaxed)) return 0;
+    return static_cast<size_t>(arenaTail_ - bytePos_[slot(head)]) - arenaUsed_;
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> LogRing::partition(size_t parts) const {
+    uint64_t head = headPos_.load(std::memory_order_acquire);
+    uint64_t tail = tailPos_.load(std::memory_order_acquire);
+    uint64_t step = (tail - head + std::max<size_t>(1, parts) - 1) / std::max<size_t>(1, parts);
+    step = std::max<uint64_t>(TIME_BUCKET_SLOTS, (step + TIME_BUCKET_SLOTS - 1) / TIME_BUCKET_SLOTS * TIME_BUCKET_SLOTS);
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    for (uint64_t from = 0, to = head / TIME_BUCKET_SLOTS * TIME_BUCKET_SLOTS + step;; to += step) {
+        if (to >= tail) {
+            ranges.emplace_back(from, std::numeric_limits<uint64_t>::max());
+            return ranges;
+        }
+        ranges.emplace_back(from, to);
+        from = to;
+    }
+}
+
+uint32_t LogRing::intern(InternCache& cache, const std::string& value) {
+    if (cache.id == StringDictionary::NONE || cache.value != value) {
+        cache.id = dictionary_.intern(value);
+        cache.value.assign(value);
+    }
+    return cache.id;
+}
+
+// [SEQUENCE: CPP-MVP7-211]
+// [SEQUENCE: CPP-MVP7-232]
+// 위치를 확보하고 시퀀스를 홀수로 표시한 뒤 내용을 쓰고, 짝수 시퀀스를 release로 게시
+void LogRing::push(const LogEntry& entry) {
+    auto [length, extra] = spanOf(entry);
+    uint64_t head = headPos_.load(std::memory_order_relaxed);
+    uint64_t headBytes = head == tailPos_.load(std::memory_order_relaxed) ? arenaTail_ : bytePos_[slot(head)];
+    if (arenaTail_ - headBytes + length + extra > arenaSize_) {
+        compact();
+    }
+    uint32_t source = intern(sourceCache_, entry.source);
+    uint32_t category = intern(categoryCache_, entry.category);
+    uint32_t levelName = intern(levelCache_, entry.level);
+
+    // 색인과 순서 어긋남 기록은 위치를 게시(tail 증가)하기 전에 반영
+    Clock::rep timestamp = entry.timestamp.time_since_epoch().count();
+    uint64_t next = tailPos_.load(std::memory_order_relaxed);
+    indexTimestamp(next, timestamp);
+    if (timestamp < lastTimestamp_) {
+        lastDisorder_.store(next, std::memory_order_relaxed);
+    }
+    lastTimestamp_ = timestamp;
+
+    uint64_t pos = tailPos_.fetch_add(1, std::memory_order_acq_rel);
+    size_t index = slot(pos);
+    seqs_[index].store(2 * pos + 1, std::memory_order_relaxed);
+    uint64_t bytePos = arenaTail_;
+    arenaTail_ += length + extra;
+    arenaReserved_.store(arenaTail_, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    copyIn(bytePos, entry.message.data(), length);
+    if (extra > 0) {
+        std::string encoded;
+        encoded.reserve(extra);
+        for (const auto& [key, value] : entry.metadata) {
+            appendField(encoded, key);
+            appendField(encoded, value);
+        }
+        copyIn(bytePos + length, encoded.data(), extra);
+    }
+    storeRelaxed(timestamps_[index], timestamp);
+    storeRelaxed(levels_[index], static_cast<uint8_t>(LogBuffer::levelRank(entry.level)));
+    storeRelaxed(sources_[index], source);
+    storeRelaxed(categories_[index], category);
+    storeRelaxed(bytePos_[index], bytePos);
+    storeRelaxed(lengths_[index], static_cast<uint32_t>(length));
+    storeRelaxed(sequences_[index], nextSequence_++);
+    levelNames_[index] = levelName;
+    extraLengths_[index] = static_cast<uint32_t>(extra);
+    seqs_[index].store(2 * pos + 2, std::memory_order_release);
+    arenaUsed_ += length + extra;
+}
+
+// 머리만 옮기므로 읽기 측은 이미 읽기 시작한 항목을 그대로 검증할 수 있음
+void LogRing::popFront() {
+    uint64_t head = headPos_.load(std::memory_order_relaxed);
+    if (head == tailPos_.load(std::memory_order_relaxed)) return;
+    arenaUsed_ -= lengths_[slot(head)] + extraLengths_[slot(head)];
+    headPos_.store(head + 1, std::memory_order_release);
+}
+
+// [SEQUENCE: CPP-MVP7-233]
+// 중간 제거: 세대를 홀수로 올린 동안 뒤 슬롯을 한 칸씩 당김
+// [SEQUENCE: CPP-MVP7-390]
+// 제거 위치가 앞쪽 절반이면 앞 슬롯을 한 칸씩 밀고 머리를 옮겨, 옮기는 슬롯 수를 min(index, size-index)로 줄임
+void LogRing::erase(size_t index) {
+    uint64_t head = headPos_.load(std::memory_order_relaxed);
+    uint64_t tail = tailPos_.load(std::memory_order_relaxed);
+    if (index >= tail - head) return;
+    if (index == 0) {
+        popFront();
+        return;
+    }
+    generation_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    arenaUsed_ -= lengths_[slot(head + index)] + extraLengths_[slot(head + index)];
+    if (index < (tail - head) / 2) {
+        for (uint64_t pos = head + index; pos > head; --pos) {
+            moveSlot(pos - 1, pos);
+        }
+        // 밀린 구간의 순서 어긋남도 한 칸 뒤로 (제거된 항목 자리였으면 다음 항목과 새로 이웃하므로 그 위치로)
+        uint64_t disorder = lastDisorder_.load(std::memory_order_relaxed);
+        if (disorder >= head && disorder <= head + index) {
+            lastDisorder_.store(disorder + 1, std::memory_order_relaxed);
+        }
+        headPos_.store(head + 1, std::memory_order_release);
+    } else {
+        for (uint64_t pos = head + index; pos + 1 < tail; ++pos) {
+            moveSlot(pos + 1, pos);
+        }
+        tailPos_.store(tail - 1, std::memory_order_release);
+    }
+    generation_.fetch_add(1, std::memory_order_release);
+}
+
+void LogRing::moveSlot(uint64_t from, uint64_t to) {
+    size_t src = slot(from);
+    size_t dst = slot(to);
+    indexTimestamp(to, timestamps_[src]);
+    storeRelaxed(timestamps_[dst], timestamps_[src]);
+    storeRelaxed(levels_[dst], levels_[src]);
+    storeRelaxed(sources_[dst], sources_[src]);
+    storeRelaxed(categories_[dst], categories_[src]);
+    storeRelaxed(bytePos_[dst], bytePos_[src]);
+    storeRelaxed(lengths_[dst], lengths_[src]);
+    storeRelaxed(sequences_[dst], sequences_[src]);
+    levelNames_[dst] = levelNames_[src];
+    extraLengths_[dst] = extraLengths_[src];
+    seqs_[dst].store(2 * to + 2, std::memory_order_relaxed);
+}
+
+// 사전 id를 문자열로 되돌려 LogEntry로 복원 (샤드 재구성용)
+LogEntry LogRing::entryAt(size_t index) const {
+    size_t i = slot(headPos_.load(std::memory_order_relaxed) + index);
+    std::string scratch;
+    LogEntry entry(std::string(view(bytePos_[i], lengths_[i], scratch)), dictionary_.lookup(levelNames_[i]),
+                   dictionary_.lookup(sources_[i]), dictionary_.lookup(categories_[i]));
+    entry.timestamp = Clock::time_point(Clock::duration(timestamps_[i]));
+    std::string_view encoded = view(bytePos_[i] + lengths_[i], extraLengths_[i], scratch);
+    std::string key, value;
+    while (readField(encoded, key) && readField(encoded, value)) {
+        entry.metadata.emplace_back(std::move(key), std::move(value));
+    }
+    return entry;
+}
+
+LogRing::Record LogRing::recordAt(size_t index, std::string& scratch) const {
+    uint64_t pos = headPos_.load(std::memory_order_relaxed) + index;
+    size_t i = slot(pos);
+    return {timestamps_[i], pos, generation_.load(std::memory_order_relaxed), sequences_[i], sources_[i],
+            categories_[i], levels_[i], view(bytePos_[i], lengths_[i], scratch)};
+}
+
+// [SEQUENCE: CPP-MVP7-212]
+// 단조 바이트 위치를 아레나 오프셋으로 바꿔 복사 (끝을 넘으면 두 조각)
+void LogRing::copyIn(uint64_t pos, const char* data, size_t length) {
+    size_t offset = static_cast<size_t>(pos % arenaSize_);
+    size_t first = std::min(length, arenaSize_ - offset);
+    storeBytes(offset, data, first);
+    if (first < length) {
+        storeBytes(0, data + first, length - first);
+    }
+}
+
+std::string_view LogRing::view(uint64_t pos, size_t length, std::string& scratch) const {
+    size_t offset = static_cast<size_t>(pos % arenaSize_);
+    if (offset + length <= arenaSize_) {
+        return {bytes() + offset, length};
+    }
+    size_t first = arenaSize_ - offset;
+    scratch.assign(bytes() + offset, first);
+    scratch.append(bytes(), length - first);
+    return scratch;
+}
+
+std::string_view LogRing::copyOut(uint64_t pos, size_t length, std::string& scratch) const {
+    size_t offset = static_cast<size_t>(pos % arenaSize_);
+    size_t first = std::min(length, arenaSize_ - offset);
+    scratch.resize(length);
+    loadBytes(offset, scratch.data(), first);
+    if (first < length) {
+        loadBytes(0, scratch.data() + first, length - first);
+    }
+    return scratch;
+}
+
+// [SEQUENCE: CPP-MVP7-395]
+// 앞뒤의 단어 일부는 단어를 통째로 읽어 해당 바이트만 바꾸거나 꺼냄
+void LogRing::storeBytes(size_t offset, const char* data, size_t length) {
+    while (length > 0) {
+        size_t word = offset / sizeof(uint64_t);
+        size_t skip = offset % sizeof(uint64_t);
+        size_t chunk = std::min(length, sizeof(uint64_t) - skip);
+        uint64_t value;
+        if (chunk == sizeof(uint64_t)) {
+            std::memcpy(&value, data, sizeof(value));
+        } else {
+            value = arena_[word];
+            std::memcpy(reinterpret_cast<char*>(&value) + skip, data, chunk);
+        }
+        storeRelaxed(arena_[word], value);
+        offset += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+}
+
+void LogRing::loadBytes(size_t offset, char* out, size_t length) const {
+    while (length > 0) {
+        size_t word = offset / sizeof(uint64_t);
+        size_t skip = offset % sizeof(uint64_t);
+        size_t chunk = std::min(length, sizeof(uint64_t) - skip);
+        uint64_t value = loadRelaxed(arena_[word]);
+        std::memcpy(out, reinterpret_cast<const char*>(&value) + skip, chunk);
+        offset += chunk;
+        out += chunk;
+        length -= chunk;
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-213]
+// 중간 제거로 생긴 구멍 때문에 사용 영역이 아레나를 넘을 때, 살아 있는 메시지를 가장 오래된 위치부터
+// 앞으로 모음 (추가 할당 없음). 옮기는 동안 세대를 홀수로 두어 읽기 측이 다시 시작하게 함
+void LogRing::compact() {
+    uint64_t head = headPos_.load(std::memory_order_relaxed);
+    uint64_t tail = tailPos_.load(std::memory_order_relaxed);
+    if (head == tail) return;
+    generation_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint64_t cursor = bytePos_[slot(head)];
+    char chunkBuffer[4096];
+    for (uint64_t pos = head; pos < tail; ++pos) {
+        size_t index = slot(pos);
+        uint64_t from = bytePos_[index];
+        size_t remaining = lengths_[index] + extraLengths_[index];
+        storeRelaxed(bytePos_[index], cursor);
+        // cursor <= from이므로 앞에서부터 조각 단위로 옮기면 겹쳐도 안전
+        uint64_t to = cursor;
+        cursor += remaining;
+        while (remaining > 0 && from != to) {
+            size_t fromOffset = static_cast<size_t>(from % arenaSize_);
+            size_t toOffset = static_cast<size_t>(to % arenaSize_);
+            size_t chunk = std::min({remaining, arenaSize_ - fromOffset, arenaSize_ - toOffset, sizeof(chunkBuffer)});
+            // 조각을 먼저 모두 읽고 쓰므로 겹쳐도 아직 읽지 않은 바이트를 덮지 않음
+            std::memcpy(chunkBuffer, bytes() + fromOffset, chunk);
+            storeBytes(toOffset, chunkBuffer, chunk);
+            from += chunk;
+            to += chunk;
+            remaining -= chunk;
+        }
+    }
+    arenaTail_ = cursor;
+    arenaReserved_.store(cursor, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+}
@@ -7,20 +7,24 @@
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <sys/un.h>
+#include <sys/stat.h>
 #include <stdexcept>
 #include <signal.h>
+// [SEQUENCE: CPP-MVP7-6]
+#include <thread>
 
 // [SEQUENCE: CPP-MVP1-10]
 // 생성자: 리소스 획득 (소켓 생성, 바인딩, 리스닝)
 // [SEQUENCE: CPP-MVP2-32]
 // 생성자: 모든 멤버 변수 초기화
 LogServer::LogServer(int port, int queryPort)
-    : port_(port), queryPort_(queryPort), listenFd_(-1), queryFd_(-1), running_(false) {
+    : port_(port), queryPort_(queryPort), queryFd_(-1), reactorCount_(1), ioBackend_(Reactor::Backend::EPOLL), running_(false),
+      binaryPort_(0), syslogPort_(0), syslogFd_(-1), unixStreamFd_(-1), unixDgramFd_(-1) {
     logger_ = std::make_unique<ConsoleLogger>();
     threadPool_ = std::make_unique<ThreadPool>();
     logBuffer_ = std::make_shared<LogBuffer>();
     queryHandler_ = std::make_unique<QueryHandler>(logBuffer_);
-    FD_ZERO(&masterSet_);
 }
 
 // [SEQUENCE: CPP-MVP1-11]
@@ -29,16 +33,74 @@ LogServer::LogServer(int port, int queryPort)
 // 소멸자: 서버 중지
 LogServer::~LogServer() {
     stop();
+    // [SEQUENCE: CPP-MVP7-8]
+    // 남은 배치 작업이 리액터/버퍼/영속성 관리자를 사용하므로 워커를 먼저 정리
+    threadPool_.reset();
+    reactors_.clear();
+    // [SEQUENCE: CPP-MVP7-119]
+    // 수신 스레드가 끝난 뒤에 소켓을 닫음
+    syslogReceiver_.reset();
+    if (syslogFd_ != -1) {
+        close(syslogFd_);
+    }
+    unixReceiver_.reset();
+    if (unixDgramFd_ != -1) {
+        close(unixDgramFd_);
+        unlink(unixDgramPath_.c_str());
+    }
+    if (!unixStreamPath_.empty()) {
+        unlink(unixStreamPath_.c_str());
+    }
 }
 
 // [SEQUENCE: CPP-MVP2-34]
 // 서버 시작
+// [SEQUENCE: CPP-MVP7-39]
+// 리액터 0은 호출 스레드에서 실행되고, 나머지는 코어에 고정된 전용 스레드에서 실행
 void LogServer::start() {
     if (running_) return;
     initialize();
     running_ = true;
-    logger_->log("Server started.");
-    runEventLoop();
+    logger_->log("Server started with " + std::to_string(reactors_.size()) + " " +
+                 Reactor::backendName(reactors_[0]->getBackend()) + " reactor(s), overflow policy " +
+                 LogBuffer::policyName(logBuffer_->getOverflowPolicy()) + ".");
+
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    bool pin = reactors_.size() > 1;
+    for (size_t i = 1; i < reactors_.size(); ++i) {
+        reactors_[i]->startThread(pin ? static_cast<int>(i % cores) : -1);
+    }
+    // [SEQUENCE: CPP-MVP7-120]
+    if (rateLimiter_) {
+        const RateLimitConfig& limits = rateLimiter_->config();
+        logger_->log("Rate limit: " + std::to_string(static_cast<long long>(limits.connectionRate)) + "/s per connection, " +
+                     std::to_string(static_cast<long long>(limits.sourceRate)) + "/s per source, action " +
+                     RateLimitConfig::actionName(limits.action));
+    }
+    if (binaryPort_ > 0) {
+        logger_->log("Binary ingest listening on port " + std::to_string(binaryPort_));
+    }
+    if (syslogReceiver_) {
+        syslogReceiver_->startThread();
+        logger_->log("UDP syslog listening on port " + std::to_string(syslogPort_));
+    }
+    if (unixStreamFd_ != -1) {
+        logger_->log("Unix stream socket listening on " + unixStreamPath_);
+    }
+    if (unixReceiver_) {
+        unixReceiver_->startThread();
+        logger_->log("Unix datagram socket listening on " + unixDgramPath_);
+    }
+    reactors_[0]->run();
+    for (auto& reactor : reactors_) {
+        reactor->join();
+    }
+    if (syslogReceiver_) {
+        syslogReceiver_->join();
+    }
+    if (unixReceiver_) {
+        unixReceiver_->join();
+    }
 }
 
 // [SEQUENCE: CPP-MVP2-35]
@@ -46,25 +108,105 @@ void LogServer::start() {
 void LogServer::stop() {
     if (!running_.exchange(false)) return;
 
-    if (listenFd_ != -1) {
-        shutdown(listenFd_, SHUT_RDWR);
-        close(listenFd_);
+    // [SEQUENCE: CPP-MVP7-9]
+    // epoll_wait에서 대기 중인 리액터를 깨움
+    for (auto& reactor : reactors_) {
+        reactor->stop();
+    }
+    if (syslogReceiver_) {
+        syslogReceiver_->stop();
+    }
+    if (unixReceiver_) {
+        unixReceiver_->stop();
+    }
+    for (int fd : listenFds_) {
+        shutdown(fd, SHUT_RDWR);
+        close(fd);
+    }
+    listenFds_.clear();
+    if (unixStreamFd_ != -1) {
+        shutdown(unixStreamFd_, SHUT_RDWR);
+        close(unixStreamFd_);
+        unixStreamFd_ = -1;
     }
     if (queryFd_ != -1) {
         shutdown(queryFd_, SHUT_RDWR);
         close(queryFd_);
+        queryFd_ = -1;
     }
     logger_->log("Server stopped.");
 }
 
+// [SEQUENCE: CPP-MVP7-40]
+void LogServer::setReactorCount(size_t count) {
+    reactorCount_ = std::max<size_t>(1, count);
+}
+
+// [SEQUENCE: CPP-MVP7-76]
+void LogServer::setIoBackend(Reactor::Backend backend) {
+    ioBackend_ = backend;
+}
+
+// [SEQUENCE: CPP-MVP7-121]
+void LogServer::setSyslogPort(int port) {
+    syslogPort_ = port;
+}
+
+// [SEQUENCE: CPP-MVP7-179]
+void LogServer::setOverflowPolicy(LogBuffer::OverflowPolicy policy) {
+    logBuffer_->setOverflowPolicy(policy);
+}
+
+// [SEQUENCE: CPP-MVP7-265]
+void LogServer::setBufferBudget(size_t bytes) {
+    logBuffer_->setByteBudget(bytes);
+}
+
+// [SEQUENCE: CPP-MVP7-336]
+void LogServer::setIndexMode(LogBuffer::IndexMode mode) {
+    logBuffer_->setIndexMode(mode);
+}
+
+// [SEQUENCE: CPP-MVP7-354]
+void LogServer::setQueryThreads(size_t threads) {
+    logBuffer_->setQueryThreads(threads);
+}
+
+// [SEQUENCE: CPP-MVP7-285]
+void LogServer::setSpillConfig(const SegmentStoreConfig& config) {
+    spillConfig_ = config;
+}
+
+// [SEQUENCE: CPP-MVP7-199]
+void LogServer::setRateLimit(const RateLimitConfig& config) {
+    rateLimiter_ = config.enabled() ? std::make_shared<RateLimiter>(config) : nullptr;
+    queryHandler_->setRateLimiter(rateLimiter_);
+}
+
+// [SEQUENCE: CPP-MVP7-152]
+void LogServer::setBinaryPort(int port) {
+    binaryPort_ = port;
+}
+
+// [SEQUENCE: CPP-MVP7-133]
+void LogServer::setUnixSocketPaths(const std::string& streamPath, const std::string& dgramPath) {
+    unixStreamPath_ = streamPath;
+    unixDgramPath_ = dgramPath;
+}
+
 // [SEQUENCE: CPP-MVP2-36]
 // 리스너 소켓 생성 및 초기화
 void LogServer::initialize() {
-    auto create_listener = [&](int port) -> int {
+    auto create_listener = [&](int port, bool reuse_port) -> int {
         int fd = socket(AF_INET, SOCK_STREAM, 0);
         if (fd < 0) throw std::runtime_error("Socket creation failed");
         int opt = 1;
         setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+        // [SEQUENCE: CPP-MVP7-41]
+        // 같은 포트에 여러 리스너를 바인딩하여 커널이 accept를 리액터들에 분산
+        if (reuse_port && setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)) < 0) {
+            throw std::runtime_error("SO_REUSEPORT not supported");
+        }
         sockaddr_in addr {};
         addr.sin_family = AF_INET;
         addr.sin_addr.s_addr = INADDR_ANY;
@@ -73,51 +215,80 @@ void LogServer::initialize() {
         if (listen(fd, 128) < 0) throw std::runtime_error("Listen failed");
         return fd;
     };
-    listenFd_ = create_listener(port_);
-    queryFd_ = create_listener(queryPort_);
-    FD_SET(listenFd_, &masterSet_);
-    FD_SET(queryFd_, &masterSet_);
-}
-
-// [SEQUENCE: CPP-MVP1-12]
-// [SEQUENCE: CPP-MVP2-37]
-// 메인 이벤트 루프
-void LogServer::runEventLoop() {
-    while (running_) {
-        fd_set read_fds = masterSet_;
-        int max_fd = std::max(listenFd_, queryFd_);
-        int result = select(max_fd + 1, &read_fds, nullptr, nullptr, nullptr);
-        if (result < 0 && errno != EINTR) {
-            logger_->log("Select error");
-            break;
-        }
 
-        if (FD_ISSET(listenFd_, &read_fds)) {
-            handleNewConnection(listenFd_, false);
-        }
-        if (FD_ISSET(queryFd_, &read_fds)) {
-            handleNewConnection(queryFd_, true);
+    // [SEQUENCE: CPP-MVP7-42]
+    // 리액터마다 자체 수집 리스너를 가지며, 쿼리 리스너는 리액터 0에만 등록
+    bool reuse_port = reactorCount_ > 1;
+    reactors_.clear();
+    for (size_t i = 0; i < reactorCount_; ++i) {
+        int fd = create_listener(port_, reuse_port);
+        listenFds_.push_back(fd);
+        auto reactor = Reactor::create(ioBackend_, this, static_cast<int>(i));
+        reactor->addListener(fd, Reactor::Protocol::TEXT);
+        // [SEQUENCE: CPP-MVP7-151]
+        // 바이너리 수집 리스너도 텍스트와 같은 방식으로 리액터마다 생성 (선택)
+        if (binaryPort_ > 0) {
+            int binaryFd = create_listener(binaryPort_, reuse_port);
+            listenFds_.push_back(binaryFd);
+            reactor->addListener(binaryFd, Reactor::Protocol::BINARY);
         }
+        reactors_.push_back(std::move(reactor));
+    }
+    // [SEQUENCE: CPP-MVP7-228]
+    // 생산자마다 버퍼 샤드 하나: 리액터들, UDP syslog 수신기, AF_UNIX 데이터그램 수신기
+    size_t producers = reactorCount_;
+    size_t syslogShard = syslogPort_ > 0 ? producers++ : 0;
+    size_t unixShard = !unixDgramPath_.empty() ? producers++ : 0;
+    logBuffer_->setShardCount(producers);
+    // [SEQUENCE: CPP-MVP7-286]
+    // 디스크 계층은 링 위치를 기록하므로 샤드가 정해진 뒤 연결
+    if (spillConfig_.enabled) {
+        logBuffer_->setSpillStore(std::make_shared<SegmentStore>(spillConfig_));
     }
-}
 
-// [SEQUENCE: CPP-MVP2-38]
-// 새 연결 처리
-void LogServer::handleNewConnection(int listener_fd, bool is_query_port) {
-    int client_fd = accept(listener_fd, nullptr, nullptr);
-    if (client_fd < 0) return;
+    queryFd_ = create_listener(queryPort_, false);
+    reactors_[0]->addListener(queryFd_, Reactor::Protocol::QUERY);
 
-    // [SEQUENCE: CPP-MVP5-2]
-    // 클라이언트 수 제한 확인
-    if (client_count_ >= 1024) { // MAX_CLIENTS
-        close(client_fd);
-        return;
+    // [SEQUENCE: CPP-MVP7-122]
+    // UDP syslog 소켓 (선택)
+    if (syslogPort_ > 0) {
+        syslogFd_ = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (syslogFd_ < 0) throw std::runtime_error("UDP socket creation failed");
+        int opt = 1;
+        setsockopt(syslogFd_, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+        sockaddr_in addr {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = INADDR_ANY;
+        addr.sin_port = htons(syslogPort_);
+        if (bind(syslogFd_, (sockaddr*)&addr, sizeof(addr)) < 0) throw std::runtime_error("UDP bind failed");
+        syslogReceiver_ = std::make_unique<DatagramReceiver>(this, syslogFd_, DatagramReceiver::Format::SYSLOG, syslogShard);
     }
 
-    if (is_query_port) {
-        threadPool_->enqueue(&LogServer::handleQueryTask, this, client_fd);
-    } else {
-        threadPool_->enqueue(&LogServer::handleClientTask, this, client_fd);
+    // [SEQUENCE: CPP-MVP7-132]
+    // 같은 호스트 에이전트용 AF_UNIX 소켓 (선택). 스트림은 TCP와 같은 리액터 수집 경로를 사용
+    auto create_unix_socket = [&](const std::string& path, int type) -> int {
+        int fd = socket(AF_UNIX, type | SOCK_CLOEXEC, 0);
+        if (fd < 0) throw std::runtime_error("Unix socket creation failed");
+        sockaddr_un addr {};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) throw std::runtime_error("Unix socket path too long: " + path);
+        std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+        // 이전 실행이 남긴 소켓 파일 제거
+        struct stat st;
+        if (lstat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode)) {
+            unlink(path.c_str());
+        }
+        if (bind(fd, (sockaddr*)&addr, sizeof(addr)) < 0) throw std::runtime_error("Unix bind failed: " + path);
+        if (type == SOCK_STREAM && listen(fd, 128) < 0) throw std::runtime_error("Listen failed");
+        return fd;
+    };
+    if (!unixStreamPath_.empty()) {
+        unixStreamFd_ = create_unix_socket(unixStreamPath_, SOCK_STREAM);
+        reactors_[0]->addListener(unixStreamFd_, Reactor::Protocol::TEXT);
+    }
+    if (!unixDgramPath_.empty()) {
+        unixDgramFd_ = create_unix_socket(unixDgramPath_, SOCK_DGRAM);
+        unixReceiver_ = std::make_unique<DatagramReceiver>(this, unixDgramFd_, DatagramReceiver::Format::LINES, unixShard);
     }
 }
 
@@ -125,53 +296,53 @@ void LogServer::handleNewConnection(int listener_fd, bool is_query_port) {
 // [SEQUENCE: CPP-MVP2-39]
 // [SEQUENCE: CPP-MVP4-17]
 // 클라이언트 작업 핸들러 (MVP4 버전)
-void LogServer::handleClientTask(int client_fd) {
-    client_count_++;
-    char buffer[4096];
-    while (true) {
-        ssize_t nbytes = recv(client_fd, buffer, sizeof(buffer) - 1, 0);
-        if (nbytes <= 0) break;
-        buffer[nbytes] = '\0';
-        
-        // [SEQUENCE: CPP-MVP5-3]
-        // 로그 메시지 크기 제한
-        const int SAFE_LOG_LENGTH = 1024;
-        std::string log_message(buffer, (nbytes > SAFE_LOG_LENGTH) ? SAFE_LOG_LENGTH : nbytes);
-        if (nbytes > SAFE_LOG_LENGTH) {
-            log_message += "...";
-        }
-
-        // 1. 인메모리 버퍼에 저장
-        logBuffer_->push(log_message, "info", "unknown"); // MVP6: Add level and source
-
-        // [SEQUENCE: CPP-MVP4-18]
-        // 2. 영속성 관리자에게 쓰기 요청 (활성화된 경우)
-        if (persistence_) {
-            persistence_->write(log_message);
+// [SEQUENCE: CPP-MVP7-18]
+// 소켓을 직접 읽지 않고 리액터가 넘긴 배치를 버퍼와 영속성 관리자에 기록
+// [SEQUENCE: CPP-MVP7-123]
+// 스트림, 데이터그램 수집 경로가 모두 레벨/소스가 채워진 항목 묶음으로 커밋
+void LogServer::commitEntries(std::vector<LogEntry>& entries, size_t shard) {
+    // [SEQUENCE: CPP-MVP4-18]
+    // 2. 영속성 관리자에게 쓰기 요청 (활성화된 경우)
+    if (persistence_) {
+        for (const auto& entry : entries) {
+            persistence_->write(entry);
         }
     }
-    close(client_fd);
-    client_count_--;
+    // 1. 인메모리 버퍼에 저장
+    // [SEQUENCE: CPP-MVP7-95]
+    // 배치 전체를 한 번의 락 획득으로 삽입
+    logBuffer_->pushBatch(entries, shard);
+}
+
+// [SEQUENCE: CPP-MVP7-131]
+// SO_PEERCRED / SCM_CREDENTIALS 자격 증명을 LogEntry::source 형식으로 변환
+std::string LogServer::credentialSource(long pid, long uid) {
+    return "uid=" + std::to_string(uid) + ",pid=" + std::to_string(pid);
 }
 
 // [SEQUENCE: CPP-MVP4-19]
 // PersistenceManager 설정 메소드 구현
 void LogServer::setPersistenceManager(std::unique_ptr<PersistenceManager> persistence) {
     persistence_ = std::move(persistence);
+    persistence_->setDictionary(&logBuffer_->dictionary());
+    // [SEQUENCE: CPP-MVP7-96]
+    // 이전 실행에서 기록된 로그를 버퍼로 복원 (수집과 같은 배치 삽입 경로 사용)
+    size_t restored = persistence_->load([this](std::vector<LogEntry>& batch) {
+        logBuffer_->pushBatch(batch);
+    });
+    if (restored > 0) {
+        logger_->log("Restored " + std::to_string(restored) + " logs from persistence");
+    }
 }
 
 // [SEQUENCE: CPP-MVP2-40]
 // 쿼리 클라이언트 작업
-void LogServer::handleQueryTask(int client_fd) {
-    char buffer[4096];
-    ssize_t nbytes = recv(client_fd, buffer, sizeof(buffer) - 1, 0);
-    if (nbytes > 0) {
-        buffer[nbytes] = '\0';
-        std::string query(buffer);
-        // Remove trailing newline
-        query.erase(query.find_last_not_of("\r\n") + 1);
-        std::string response = queryHandler_->processQuery(query);
-        send(client_fd, response.c_str(), response.length(), 0);
-    }
+// [SEQUENCE: CPP-MVP7-19]
+// 요청 읽기는 리액터가 끝냈으므로 워커는 처리와 응답 전송만 담당
+void LogServer::handleQueryTask(int client_fd, std::string query) {
+    // Remove trailing newline
+    query.erase(query.find_last_not_of("\r\n") + 1);
+    std::string response = queryHandler_->processQuery(query);
+    send(client_fd, response.c_str(), response.length(), MSG_NOSIGNAL);
     close(client_fd);
-}
\ No newline at end of file
+}
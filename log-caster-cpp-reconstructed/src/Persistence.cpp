@@ -2,6 +2,43 @@
 #include "Persistence.h"
 #include <iostream>
 #include <iomanip>
+#include <sstream>
+#include <cstdlib>
+
+// [SEQUENCE: CPP-MVP7-381]
+// 줄 단위 형식이라 메시지와 사전 문자열의 '\\', '\n', '\r'을 두 글자로 바꿔 기록하고 읽을 때 되돌림.
+// (syslog/바이너리 수집 본문에 줄바꿈이 들어 있으면 복원 때 레코드가 나뉘거나 정의 줄이 끼어들 수 있음)
+namespace {
+std::string escapeField(const std::string& value) {
+    if (value.find_first_of("\\\n\r") == std::string::npos) return value;
+    std::string escaped;
+    escaped.reserve(value.size() + 8);
+    for (char c : value) {
+        switch (c) {
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\r': escaped += "\\r"; break;
+            default: escaped.push_back(c);
+        }
+    }
+    return escaped;
+}
+
+std::string unescapeField(const std::string& value) {
+    if (value.find('\\') == std::string::npos) return value;
+    std::string unescaped;
+    unescaped.reserve(value.size());
+    for (size_t i = 0; i < value.size(); ++i) {
+        if (value[i] != '\\' || i + 1 == value.size()) {
+            unescaped.push_back(value[i]);
+            continue;
+        }
+        char next = value[++i];
+        unescaped.push_back(next == 'n' ? '\n' : next == 'r' ? '\r' : next);
+    }
+    return unescaped;
+}
+} // namespace
 
 // [SEQUENCE: MVP4-8]
 // 생성자: 디렉토리 생성, 파일 열기, Writer 스레드 시작
@@ -41,20 +78,85 @@ PersistenceManager::~PersistenceManager() {
 
 // [SEQUENCE: MVP4-10]
 // 외부에서 로그 쓰기를 요청하는 API
-void PersistenceManager::write(const std::string& message) {
+// [SEQUENCE: CPP-MVP7-253]
+// 문자열 필드는 호출 스레드에서 id로 바꿔 큐에는 메시지와 정수만 넣음
+void PersistenceManager::write(const LogEntry& entry) {
     if (!config_.enabled) return;
+    Record record{entry.timestamp.time_since_epoch().count(), StringDictionary::NONE,
+                  StringDictionary::NONE, StringDictionary::NONE, entry.message};
+    if (dictionary_) {
+        record.level = dictionary_->intern(entry.level);
+        record.source = dictionary_->intern(entry.source);
+        record.category = dictionary_->intern(entry.category);
+    }
     {
         std::lock_guard<std::mutex> lock(queue_mutex_);
-        write_queue_.push(message);
+        write_queue_.push(std::move(record));
     }
     condition_.notify_one();
 }
 
+// [SEQUENCE: CPP-MVP7-98]
+// 재시작 시 복원용 로드. writer 스레드는 append만 하므로 읽기와 충돌하지 않음
+size_t PersistenceManager::load(const LoadCallback& callback, size_t batchSize) {
+    if (!config_.enabled) return 0;
+
+    std::ifstream in(current_filepath_);
+    if (!in.is_open()) return 0;
+
+    size_t loaded = 0;
+    std::vector<LogEntry> batch;
+    batch.reserve(batchSize);
+    // [SEQUENCE: CPP-MVP7-254]
+    // 파일 안의 id는 기록한 프로세스의 사전 기준이므로 파일 내 정의로 문자열을 되찾음
+    std::vector<std::string> names;
+    auto name = [&names](uint32_t id, const char* fallback) {
+        return id < names.size() && !names[id].empty() ? names[id] : std::string(fallback);
+    };
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        if (line[0] != RECORD_MARK) {
+            batch.emplace_back(std::move(line), "info", "unknown");
+        } else if (line.size() > 1 && line[1] == 'D') {
+            size_t tab = line.find('\t', 2);
+            if (tab == std::string::npos) continue;
+            uint32_t id = static_cast<uint32_t>(std::strtoul(line.c_str() + 2, nullptr, 10));
+            if (id == StringDictionary::NONE) continue;
+            if (id >= names.size()) names.resize(id + 1);
+            names[id] = unescapeField(line.substr(tab + 1));
+            continue;
+        } else if (line.size() > 1 && line[1] == 'E') {
+            std::istringstream fields(line.substr(2));
+            int64_t timestamp = 0;
+            uint32_t level = 0, source = 0, category = 0;
+            if (!(fields >> timestamp >> level >> source >> category)) continue;
+            fields.get();
+            std::string message;
+            std::getline(fields, message);
+            batch.emplace_back(unescapeField(message), name(level, "info"), name(source, "unknown"), name(category, ""));
+            batch.back().timestamp = std::chrono::system_clock::time_point(std::chrono::system_clock::duration(timestamp));
+        } else {
+            continue;
+        }
+        if (batch.size() >= batchSize) {
+            loaded += batch.size();
+            callback(batch);
+            batch.clear();
+        }
+    }
+    if (!batch.empty()) {
+        loaded += batch.size();
+        callback(batch);
+    }
+    return loaded;
+}
+
 // [SEQUENCE: MVP4-11]
 // Writer 스레드의 메인 루프
 void PersistenceManager::writerThread() {
     while (running_ || !write_queue_.empty()) {
-        std::queue<std::string> local_queue;
+        std::queue<Record> local_queue;
         {
             std::unique_lock<std::mutex> lock(queue_mutex_);
             condition_.wait_for(lock, config_.flush_interval, [this] { return !running_ || !write_queue_.empty(); });
@@ -64,11 +166,20 @@ void PersistenceManager::writerThread() {
             }
         }
 
+        // [SEQUENCE: CPP-MVP7-255]
+        // 레코드가 참조하는 id 중 이 파일에 아직 정의되지 않은 것을 먼저 기록
         while (!local_queue.empty()) {
-            const std::string& message = local_queue.front();
+            const Record& record = local_queue.front();
             if (log_file_.is_open()) {
-                log_file_ << message << std::endl;
-                current_file_size_ += message.length() + 1;
+                writeDefinition(record.level);
+                writeDefinition(record.source);
+                writeDefinition(record.category);
+                std::string header = std::string(1, RECORD_MARK) + "E" + std::to_string(record.timestamp) + "\t" +
+                                     std::to_string(record.level) + "\t" + std::to_string(record.source) + "\t" +
+                                     std::to_string(record.category) + "\t";
+                std::string message = escapeField(record.message);
+                log_file_ << header << message << std::endl;
+                current_file_size_ += header.length() + message.length() + 1;
             }
             local_queue.pop();
         }
@@ -96,4 +207,14 @@ void PersistenceManager::rotateFile() {
 
     log_file_.open(current_filepath_, std::ios::app);
     current_file_size_ = 0;
+    defined_.clear();
+}
+
+void PersistenceManager::writeDefinition(uint32_t id) {
+    if (id == StringDictionary::NONE || (id < defined_.size() && defined_[id])) return;
+    if (id >= defined_.size()) defined_.resize(id + 1, false);
+    defined_[id] = true;
+    std::string line = std::string(1, RECORD_MARK) + "D" + std::to_string(id) + "\t" + escapeField(dictionary_->lookup(id));
+    log_file_ << line << '\n';
+    current_file_size_ += line.length() + 1;
 }
@@ -1,7 +1,9 @@
 // [SEQUENCE: C-MVP2-24]
 #include "QueryHandler.h"
+#include "SegmentStore.h"
 // [SEQUENCE: C-MVP3-16]
 #include "QueryParser.h"
+#include "SubstringSearch.h"
 #include <sstream>
 
 QueryHandler::QueryHandler(std::shared_ptr<LogBuffer> buffer) : buffer_(buffer) {}
@@ -17,6 +19,8 @@ std::string QueryHandler::processQuery(const std::string& query) {
         return handleStats();
     } else if (query == "COUNT") {
         return handleCount();
+    } else if (query == "LIMITS") {
+        return handleLimits();
     } else if (query == "HELP") {
         return handleHelp();
     }
@@ -55,7 +59,32 @@ std::string QueryHandler::handleStats() {
     auto stats = buffer_->getStats();
     std::stringstream ss;
     ss << "STATS: Total=" << stats.totalLogs << ", Dropped=" << stats.droppedLogs 
-       << ", Current=" << buffer_->size() << "\n";
+       << ", Current=" << buffer_->size();
+    // [SEQUENCE: CPP-MVP7-169]
+    // 오버플로 정책과 정책별 버림/제한 수치
+    ss << ", Policy=" << LogBuffer::policyName(buffer_->getOverflowPolicy())
+       << ", DroppedOldest=" << stats.droppedOldest << ", DroppedNewest=" << stats.droppedNewest
+       << ", Shed=" << stats.shedLogs << ", Throttled=" << stats.throttled
+       // [SEQUENCE: CPP-MVP7-257]
+       << ", DictionaryStrings=" << buffer_->dictionary().size()
+       // [SEQUENCE: CPP-MVP7-263]
+       << ", BudgetBytes=" << stats.budgetBytes << ", LiveBytes=" << stats.liveBytes
+       << ", PeakBytes=" << stats.peakBytes << ", FragmentedBytes=" << stats.fragmentedBytes
+       // [SEQUENCE: CPP-MVP7-308]
+       << ", IndexTerms=" << stats.indexTerms << ", IndexTrigrams=" << stats.indexTrigrams
+       // [SEQUENCE: CPP-MVP7-334]
+       << ", IndexMode=" << LogBuffer::indexModeName(buffer_->getIndexMode()) << ", IndexBlocks=" << stats.indexBlocks
+       << ", IndexBytes=" << stats.indexBytes
+       // [SEQUENCE: CPP-MVP7-378]
+       << ", SearchKernel=" << SubstringSearch::kernelName();
+    // [SEQUENCE: CPP-MVP7-289]
+    // 디스크 계층 수치 (켜진 경우)
+    if (auto spill = buffer_->spillStore()) {
+        auto spillStats = spill->stats();
+        ss << ", Spilled=" << spillStats.spilledLogs << ", SpillDiscarded=" << spillStats.discardedLogs
+           << ", SpillSegments=" << spillStats.segments << ", SpillBytes=" << spillStats.diskBytes;
+    }
+    ss << "\n";
     return ss.str();
 }
 
@@ -67,12 +96,22 @@ std::string QueryHandler::handleCount() {
     return ss.str();
 }
 
+// [SEQUENCE: CPP-MVP7-201]
+// 수집 속도 제한 카운터 조회
+std::string QueryHandler::handleLimits() {
+    if (!limiter_) {
+        return "LIMITS: disabled\n";
+    }
+    return limiter_->report();
+}
+
 // [SEQUENCE: C-MVP3-21]
 // HELP 명령 내용 보강
 std::string QueryHandler::handleHelp() {
     return "Available commands:\n"
            "  STATS - Show buffer statistics\n"
            "  COUNT - Show number of logs in buffer\n"
+           "  LIMITS - Show ingest rate limit counters\n"
            "  HELP  - Show this help message\n"
            "  QUERY <parameters> - Search logs with parameters:\n"
            "\n"
@@ -82,6 +121,10 @@ std::string QueryHandler::handleHelp() {
            "  regex=<pattern>     - Regular expression pattern (case-insensitive)\n"
            "  time_from=<unix_ts> - Start time (Unix timestamp)\n"
            "  time_to=<unix_ts>   - End time (Unix timestamp)\n"
+           "  level=<LEVEL>       - Log level (DEBUG, INFO, WARN, ERROR)\n"
+           "  source=<name>       - Exact source (peer address or uid=N,pid=N)\n"
+           "  category=<name>     - Exact category (e.g. syslog APP-NAME)\n"
+           "  limit=<N>           - Return only the N most recent matches\n"
            "\n"
            "Example: QUERY keywords=error,timeout operator=AND regex=failed\n";
 }
@@ -1,8 +1,101 @@
 // [SEQUENCE: MVP3-7]
 #include "QueryParser.h"
+#include "SubstringSearch.h"
 #include <sstream>
 #include <algorithm>
 #include <iostream>
+#include <cctype>
+
+// [SEQUENCE: CPP-MVP7-317]
+// ECMAScript 패턴에서 일치하는 모든 문자열에 반드시 나오는 고정 문자열을 보수적으로 뽑음.
+// 최상위 '|'가 있으면 아무것도 요구하지 않고, 그룹/문자 클래스/이스케이프 클래스/'.'에서 문자열을 끊으며,
+// '?', '*', '{' 수량자가 붙은 글자는 빠질 수 있으므로 버림. 세 글자 미만 조각은 버림
+namespace {
+// pattern[i]의 '(' / '[' / '{'와 짝이 맞는 닫는 괄호 위치 (없으면 패턴 끝)
+size_t closingOf(const std::string& pattern, size_t i) {
+    char open = pattern[i];
+    if (open == '{') {
+        size_t close = pattern.find('}', i);
+        return close == std::string::npos ? pattern.size() : close;
+    }
+    if (open == '[') {
+        ++i;
+        if (i < pattern.size() && pattern[i] == '^') ++i;
+        if (i < pattern.size() && pattern[i] == ']') ++i;
+        for (; i < pattern.size(); ++i) {
+            if (pattern[i] == '\\') {
+                ++i;
+            } else if (pattern[i] == ']') {
+                return i;
+            }
+        }
+        return pattern.size();
+    }
+    int depth = 0;
+    for (; i < pattern.size(); ++i) {
+        if (pattern[i] == '\\') {
+            ++i;
+        } else if (pattern[i] == '[') {
+            i = closingOf(pattern, i);
+        } else if (pattern[i] == '(') {
+            ++depth;
+        } else if (pattern[i] == ')' && --depth == 0) {
+            return i;
+        }
+    }
+    return pattern.size();
+}
+
+std::vector<std::string> requiredLiterals(const std::string& pattern) {
+    std::vector<std::string> literals;
+    std::string current;
+    auto cut = [&literals, &current]() {
+        if (current.size() >= 3) literals.push_back(current);
+        current.clear();
+    };
+    for (size_t i = 0; i < pattern.size(); ++i) {
+        char c = pattern[i];
+        switch (c) {
+            case '|':
+                return {};
+            case '\\':
+                // 영숫자가 아닌 글자의 이스케이프만 그 글자 자체. \d, \x41 같은 나머지는 피연산자까지 건너뜀
+                if (i + 1 < pattern.size() && !std::isalnum(static_cast<unsigned char>(pattern[i + 1]))) {
+                    current.push_back(pattern[++i]);
+                    break;
+                }
+                if (i + 1 < pattern.size()) {
+                    char escape = pattern[++i];
+                    i += escape == 'x' ? 2 : escape == 'u' ? 4 : escape == 'c' ? 1 : 0;
+                }
+                cut();
+                break;
+            case '[':
+            case '(':
+                i = closingOf(pattern, i);
+                cut();
+                break;
+            case '?':
+            case '*':
+            case '{':
+                if (!current.empty()) current.pop_back();
+                if (c == '{') i = closingOf(pattern, i);
+                cut();
+                break;
+            case '+':
+            case '.':
+            case '^':
+            case '$':
+                cut();
+                break;
+            default:
+                current.push_back(c);
+        }
+    }
+    cut();
+    return literals;
+}
+}
 
 // [SEQUENCE: MVP3-8]
 // 쿼리 문자열을 파싱하여 ParsedQuery 객체를 생성
@@ -37,6 +130,7 @@ std::unique_ptr<ParsedQuery> QueryParser::parse(const std::string& query_string)
         } else if (key == "regex") {
             try {
                 parsed_query->compiled_regex_.emplace(value, std::regex_constants::icase);
+                parsed_query->regex_literals_ = requiredLiterals(value);
             } catch (const std::regex_error& e) {
                 throw std::runtime_error("Invalid regex pattern: " + std::string(e.what()));
             }
@@ -44,6 +138,19 @@ std::unique_ptr<ParsedQuery> QueryParser::parse(const std::string& query_string)
             parsed_query->time_from_ = std::chrono::system_clock::from_time_t(std::stol(value));
         } else if (key == "time_to") {
             parsed_query->time_to_ = std::chrono::system_clock::from_time_t(std::stol(value));
+        // [SEQUENCE: CPP-MVP7-243]
+        // 레벨(순위 비교, ERROR는 FATAL 포함), 출처, 분류 조건
+        } else if (key == "level") {
+            std::transform(value.begin(), value.end(), value.begin(), ::toupper);
+            parsed_query->level_ = LogBuffer::levelRank(value);
+        } else if (key == "source") {
+            parsed_query->source_ = value;
+        } else if (key == "category") {
+            parsed_query->category_ = value;
+        // [SEQUENCE: CPP-MVP7-344]
+        } else if (key == "limit") {
+            long limit = std::stol(value);
+            if (limit > 0) parsed_query->limit_ = static_cast<size_t>(limit);
         } else if (key == "operator") {
             std::transform(value.begin(), value.end(), value.begin(), ::toupper);
             if (value == "OR") {
@@ -51,31 +158,47 @@ std::unique_ptr<ParsedQuery> QueryParser::parse(const std::string& query_string)
             }
         }
     }
+    // [SEQUENCE: CPP-MVP7-375]
+    if (parsed_query->keywords_.size() >= ParsedQuery::KEYWORD_AUTOMATON_MIN) {
+        parsed_query->keyword_automaton_.emplace(parsed_query->keywords_);
+    }
     return parsed_query;
 }
 
 // [SEQUENCE: MVP3-10]
 // 로그가 쿼리 조건에 부합하는지 검사
-bool ParsedQuery::matches(const std::string& message, const std::chrono::system_clock::time_point& timestamp) const {
+bool ParsedQuery::matches(std::string_view message, const std::chrono::system_clock::time_point& timestamp) const {
     // 시간 필터
     if (time_from_ && timestamp < *time_from_) return false;
     if (time_to_ && timestamp > *time_to_) return false;
+    return matchesText(message);
+}
 
+bool ParsedQuery::matchesText(std::string_view message) const {
     // 정규식 필터
-    if (compiled_regex_ && !std::regex_search(message, *compiled_regex_)) {
+    if (compiled_regex_ && !std::regex_search(message.begin(), message.end(), *compiled_regex_)) {
         return false;
     }
 
     // 키워드 필터
+    // [SEQUENCE: CPP-MVP7-362]
+    // 부분 문자열 검사는 SubstringSearch 커널 사용
     if (!keywords_.empty()) {
+        // [SEQUENCE: CPP-MVP7-376]
+        // 키워드가 많으면 자동자로 한 번에 판정. AND는 대부분의 메시지가 첫 키워드에서 떨어지므로
+        // 첫 키워드를 벡터 커널로 먼저 보고, 들어 있는 메시지만 자동자로 나머지를 확인
+        if (keyword_automaton_) {
+            if (op_ == OperatorType::AND && !SubstringSearch::contains(message, keywords_.front())) return false;
+            return keyword_automaton_->matches(message, op_ == OperatorType::AND);
+        }
         if (op_ == OperatorType::AND) {
             for (const auto& kw : keywords_) {
-                if (message.find(kw) == std::string::npos) return false;
+                if (!SubstringSearch::contains(message, kw)) return false;
             }
         } else { // OR
             bool found = false;
             for (const auto& kw : keywords_) {
-                if (message.find(kw) != std::string::npos) {
+                if (SubstringSearch::contains(message, kw)) {
                     found = true;
                     break;
                 }
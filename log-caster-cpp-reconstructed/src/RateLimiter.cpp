@@ -0,0 +1,114 @@
+// [SEQUENCE: CPP-MVP7-187]
+#include "RateLimiter.h"
+#include <algorithm>
+#include <sstream>
+
+TokenBucket::TokenBucket(double rate, double burst)
+    : rate_(rate), burst_(burst > 0 ? burst : rate), tokens_(burst_), last_(Clock::now()) {}
+
+void TokenBucket::refill(Clock::time_point now) {
+    double elapsed = std::chrono::duration<double>(now - last_).count();
+    last_ = now;
+    tokens_ = std::min(burst_, tokens_ + elapsed * rate_);
+}
+
+size_t TokenBucket::available(size_t n, Clock::time_point now) {
+    refill(now);
+    if (tokens_ < 1) return 0;
+    return std::min(n, static_cast<size_t>(tokens_));
+}
+
+double TokenBucket::secondsUntilAvailable() const {
+    if (!enabled() || tokens_ >= 1) return 0;
+    return (1 - tokens_) / rate_;
+}
+
+// [SEQUENCE: CPP-MVP7-188]
+// "키=값" 목록 파싱. 알 수 없는 키나 잘못된 값이면 false
+bool RateLimitConfig::parse(const std::string& spec, RateLimitConfig& config) {
+    std::stringstream ss(spec);
+    std::string item;
+    try {
+        while (std::getline(ss, item, ',')) {
+            auto eq = item.find('=');
+            if (eq == std::string::npos) return false;
+            std::string key = item.substr(0, eq);
+            std::string value = item.substr(eq + 1);
+            if (key == "conn") {
+                config.connectionRate = std::stod(value);
+            } else if (key == "source") {
+                config.sourceRate = std::stod(value);
+            } else if (key == "burst") {
+                config.burst = std::stod(value);
+            } else if (key == "sample") {
+                config.sampleEvery = static_cast<unsigned>(std::stoul(value));
+                if (config.sampleEvery == 0) return false;
+            } else if (key == "action") {
+                if (value == "drop") config.action = Action::DROP;
+                else if (value == "sample") config.action = Action::SAMPLE;
+                else if (value == "delay") config.action = Action::DELAY;
+                else return false;
+            } else {
+                return false;
+            }
+        }
+    } catch (const std::exception&) {
+        return false;
+    }
+    return config.connectionRate >= 0 && config.sourceRate >= 0 && config.burst >= 0;
+}
+
+const char* RateLimitConfig::actionName(Action action) {
+    switch (action) {
+        case Action::DROP: return "drop";
+        case Action::SAMPLE: return "sample";
+        case Action::DELAY: return "delay";
+    }
+    return "unknown";
+}
+
+RateLimiter::RateLimiter(const RateLimitConfig& config) : config_(config) {}
+
+TokenBucket RateLimiter::makeConnectionBucket() const {
+    return TokenBucket(config_.connectionRate, config_.burst);
+}
+
+// [SEQUENCE: CPP-MVP7-189]
+// 출발지 상태 조회. 추적 한도를 넘으면 새 출발지는 "*" 하나로 묶음 (mutex_ 보유 상태)
+RateLimiter::SourceState& RateLimiter::sourceState(const std::string& source) {
+    auto it = sources_.find(source);
+    if (it != sources_.end()) return it->second;
+    const std::string& key = sources_.size() < MAX_TRACKED_SOURCES ? source : std::string("*");
+    return sources_.try_emplace(key, SourceState{TokenBucket(config_.sourceRate, config_.burst), {}}).first->second;
+}
+
+// [SEQUENCE: CPP-MVP7-190]
+// LIMITS 응답: 설정과 합계, 제한이 걸린 적 있는 출발지별 카운터
+std::string RateLimiter::report() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SourceCounters total;
+    std::vector<std::pair<std::string, SourceCounters>> limited;
+    for (const auto& [source, state] : sources_) {
+        const SourceCounters& c = state.counters;
+        total.passed += c.passed;
+        total.dropped += c.dropped;
+        total.sampled += c.sampled;
+        total.delayed += c.delayed;
+        if (c.dropped + c.sampled + c.delayed > 0) {
+            limited.emplace_back(source, c);
+        }
+    }
+    std::sort(limited.begin(), limited.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::stringstream ss;
+    ss << "LIMITS: Conn=" << config_.connectionRate << "/s, Source=" << config_.sourceRate
+       << "/s, Burst=" << config_.burst << ", Action=" << RateLimitConfig::actionName(config_.action)
+       << ", Passed=" << total.passed << ", Dropped=" << total.dropped
+       << ", Sampled=" << total.sampled << ", Delayed=" << total.delayed
+       << ", Limited=" << limited.size() << "\n";
+    for (const auto& [source, c] : limited) {
+        ss << "  " << source << " passed=" << c.passed << " dropped=" << c.dropped
+           << " sampled=" << c.sampled << " delayed=" << c.delayed << "\n";
+    }
+    return ss.str();
+}
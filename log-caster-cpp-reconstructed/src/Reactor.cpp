@@ -0,0 +1,294 @@
+// [SEQUENCE: CPP-MVP7-23]
+#include "Reactor.h"
+#include "EpollReactor.h"
+#include "UringReactor.h"
+#include "LogServer.h"
+#include <stdexcept>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <algorithm>
+
+// [SEQUENCE: CPP-MVP7-24]
+Reactor::Reactor(LogServer* server, int id)
+    : server_(server), id_(id), running_(true) {}
+
+// [SEQUENCE: CPP-MVP7-25]
+// 소멸자: 스레드 정리는 하위 클래스 소멸자에서 먼저 수행됨
+Reactor::~Reactor() {
+    join();
+}
+
+// [SEQUENCE: CPP-MVP7-51]
+// 백엔드 팩토리: io_uring 초기화 실패 시 epoll로 대체
+std::unique_ptr<Reactor> Reactor::create(Backend backend, LogServer* server, int id) {
+    if (backend == Backend::IO_URING) {
+        try {
+            return std::make_unique<UringReactor>(server, id);
+        } catch (const std::exception& e) {
+            server->logger_->log(std::string("io_uring unavailable (") + e.what() + "), falling back to epoll");
+        }
+    }
+    return std::make_unique<EpollReactor>(server, id);
+}
+
+const char* Reactor::backendName(Backend backend) {
+    return backend == Backend::IO_URING ? "io_uring" : "epoll";
+}
+
+// [SEQUENCE: CPP-MVP7-27]
+// 전용 스레드에서 리액터 실행, cpu >= 0이면 해당 코어에 고정
+void Reactor::startThread(int cpu) {
+    thread_ = std::thread([this] { run(); });
+    if (cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(thread_.native_handle(), sizeof(set), &set);
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-28]
+// 종료 요청: running_ 해제 후 백엔드별 방식으로 리액터를 깨움 (시그널 핸들러에서 호출 가능)
+void Reactor::stop() {
+    running_ = false;
+    wake();
+}
+
+void Reactor::join() {
+    if (thread_.joinable() && thread_.get_id() != std::this_thread::get_id()) {
+        thread_.join();
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-52]
+// 새 연결 등록. 전체 클라이언트 수 제한을 넘으면 nullptr (호출자가 fd를 닫음)
+Reactor::Connection* Reactor::registerConnection(uint64_t key, int fd, Protocol protocol) {
+    // [SEQUENCE: CPP-MVP5-2]
+    // 클라이언트 수 제한 확인
+    if (server_->client_count_ >= LogServer::MAX_CLIENTS) {
+        return nullptr;
+    }
+    // [SEQUENCE: CPP-MVP7-140]
+    // AF_UNIX 수집 연결은 상대 프로세스 자격 증명을 source로 사용
+    std::string source = "unknown";
+    std::string peer = "unknown";
+    sockaddr_storage local {};
+    socklen_t localLen = sizeof(local);
+    if (protocol != Protocol::QUERY && getsockname(fd, reinterpret_cast<sockaddr*>(&local), &localLen) == 0) {
+        if (local.ss_family == AF_UNIX) {
+            ucred cred {};
+            socklen_t credLen = sizeof(cred);
+            if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &credLen) == 0) {
+                source = LogServer::credentialSource(cred.pid, cred.uid);
+                peer = "uid=" + std::to_string(cred.uid);
+            } else {
+                source = peer = "unix";
+            }
+        } else {
+            // [SEQUENCE: CPP-MVP7-193]
+            // TCP 출발지 주소 (속도 제한 키)
+            sockaddr_in remote {};
+            socklen_t remoteLen = sizeof(remote);
+            char addr[INET_ADDRSTRLEN];
+            if (getpeername(fd, reinterpret_cast<sockaddr*>(&remote), &remoteLen) == 0 &&
+                inet_ntop(AF_INET, &remote.sin_addr, addr, sizeof(addr))) {
+                peer = addr;
+            }
+        }
+    }
+    auto conn = std::make_unique<Connection>(fd, protocol, LogServer::SAFE_LOG_LENGTH, std::move(source));
+    conn->key = key;
+    conn->peer = std::move(peer);
+    if (server_->rateLimiter_) {
+        conn->bucket = server_->rateLimiter_->makeConnectionBucket();
+    }
+    Connection* raw = conn.get();
+    connections_[key] = std::move(conn);
+    server_->client_count_++;
+    return raw;
+}
+
+// [SEQUENCE: CPP-MVP7-31]
+// 수신 데이터 소비. 쿼리 연결이 요청을 모두 받았으면 true를 반환
+// [SEQUENCE: CPP-MVP7-150]
+// 바이너리 연결은 잘못된 프레임이면 true를 반환 (더 읽지 않고 연결 종료)
+// [SEQUENCE: CPP-MVP7-88]
+// 수집 연결은 recv 단위가 아니라 줄 단위로 잘라 리액터 배치에 추가
+bool Reactor::consume(Connection& conn, const char* data, size_t len) {
+    if (conn.isQuery) {
+        conn.inbuf.append(data, len);
+        return isQueryComplete(conn);
+    }
+    RateLimiter* limiter = server_->rateLimiter_.get();
+    if (conn.binary) {
+        size_t first = batch_.size();
+        bool ok = conn.binary->feed(data, len, batch_);
+        if (limiter) {
+            double delay = limiter->apply(&conn.bucket, conn.peer, batch_, first, conn.sampleCounter, true);
+            if (delay > 0) delayConnection(conn, delay);
+        }
+        return !ok;
+    }
+    conn.framer.feed(data, len, lines_);
+    // [SEQUENCE: CPP-MVP7-194]
+    // 버퍼에 넣기 전에 연결/출발지 한도 적용
+    if (limiter) {
+        double delay = limiter->apply(&conn.bucket, conn.peer, lines_, 0, conn.sampleCounter, true);
+        if (delay > 0) delayConnection(conn, delay);
+    }
+    appendLines(conn.source);
+    return false;
+}
+
+void Reactor::appendLines(const std::string& source) {
+    for (auto& line : lines_) {
+        batch_.emplace_back(std::move(line), "info", source); // MVP6: Add level and source
+    }
+    lines_.clear();
+}
+
+bool Reactor::isQueryComplete(const Connection& conn) const {
+    return conn.inbuf.find('\n') != std::string::npos || conn.inbuf.size() >= LogServer::MAX_QUERY_LENGTH;
+}
+
+// [SEQUENCE: CPP-MVP7-53]
+// 쿼리 연결을 리액터에서 분리하여 워커가 응답 후 닫도록 함
+// (호출 전에 백엔드가 해당 fd 감시를 중단해야 함)
+void Reactor::dispatchQuery(uint64_t key) {
+    auto it = connections_.find(key);
+    if (it == connections_.end()) return;
+    int fd = it->second->fd;
+    std::string query = it->second->inbuf.substr(0, it->second->inbuf.find('\n'));
+    connections_.erase(it);
+    server_->client_count_--;
+
+    if (query.empty()) {
+        close(fd);
+        return;
+    }
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags >= 0) fcntl(fd, F_SETFL, flags & ~O_NONBLOCK);
+    server_->threadPool_->enqueue(&LogServer::handleQueryTask, server_, fd, std::move(query));
+}
+
+// [SEQUENCE: CPP-MVP7-32]
+// 연결 해제 및 소켓 닫기
+void Reactor::releaseConnection(uint64_t key) {
+    auto it = connections_.find(key);
+    if (it == connections_.end()) return;
+    // [SEQUENCE: CPP-MVP7-89]
+    // 개행 없이 끝난 마지막 줄도 기록
+    if (it->second->protocol == Protocol::TEXT) {
+        Connection& conn = *it->second;
+        conn.framer.flush(lines_);
+        if (server_->rateLimiter_) {
+            server_->rateLimiter_->apply(&conn.bucket, conn.peer, lines_, 0, conn.sampleCounter, false);
+        }
+        appendLines(conn.source);
+    }
+    close(it->second->fd);
+    connections_.erase(it);
+    paused_.erase(key);
+    server_->client_count_--;
+}
+
+// [SEQUENCE: CPP-MVP7-171]
+bool Reactor::ingestBlocked() const {
+    const auto& buffer = server_->logBuffer_;
+    return buffer->getOverflowPolicy() == LogBuffer::OverflowPolicy::BLOCK &&
+           !buffer->hasSpace(static_cast<size_t>(id_), batch_.size() + pendingCount_.load(std::memory_order_relaxed));
+}
+
+void Reactor::pauseConnection(uint64_t key) {
+    paused_.insert(key);
+}
+
+void Reactor::throttleConnection(uint64_t key) {
+    if (paused_.insert(key).second) {
+        server_->logBuffer_->recordThrottle();
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-195]
+void Reactor::delayConnection(Connection& conn, double seconds) {
+    auto until = TokenBucket::Clock::now() +
+                 std::chrono::duration_cast<TokenBucket::Clock::duration>(std::chrono::duration<double>(seconds));
+    conn.resumeAt = std::max(conn.resumeAt, until);
+    pauseConnection(conn.key);
+}
+
+bool Reactor::resumable(const Connection& conn, TokenBucket::Clock::time_point now) const {
+    return now >= conn.resumeAt && !ingestBlocked();
+}
+
+int Reactor::resumeTimeoutMs() const {
+    if (paused_.empty()) return -1;
+    auto now = TokenBucket::Clock::now();
+    long long timeout = RESUME_CHECK_MS;
+    for (uint64_t key : paused_) {
+        auto it = connections_.find(key);
+        if (it == connections_.end()) continue;
+        auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(it->second->resumeAt - now).count();
+        timeout = std::min(timeout, std::max<long long>(1, wait));
+    }
+    return static_cast<int>(timeout);
+}
+
+// [SEQUENCE: CPP-MVP7-13]
+// 루프 종료 시 남은 연결 정리
+void Reactor::closeAllConnections() {
+    for (auto& [key, conn] : connections_) {
+        close(conn->fd);
+        server_->client_count_--;
+    }
+    connections_.clear();
+    paused_.clear();
+}
+
+void Reactor::log(const std::string& message) {
+    server_->logger_->log("[reactor " + std::to_string(id_) + "] " + message);
+}
+
+// [SEQUENCE: CPP-MVP7-33]
+// 리액터 배치를 대기열로 옮기고, 진행 중인 워커 작업이 없을 때만 새로 예약
+void Reactor::flushBatch() {
+    if (batch_.empty()) return;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pendingCount_ += batch_.size();
+        if (pending_.empty()) {
+            pending_.swap(batch_);
+        } else {
+            pending_.insert(pending_.end(),
+                            std::make_move_iterator(batch_.begin()),
+                            std::make_move_iterator(batch_.end()));
+            batch_.clear();
+        }
+        if (scheduled_) return;
+        scheduled_ = true;
+    }
+    server_->threadPool_->enqueue([this] { drainPending(); });
+}
+
+// [SEQUENCE: CPP-MVP7-34]
+// 워커 스레드: 대기 배치가 빌 때까지 LogServer에 커밋
+void Reactor::drainPending() {
+    while (true) {
+        std::vector<LogEntry> batch;
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            if (pending_.empty()) {
+                scheduled_ = false;
+                return;
+            }
+            batch.swap(pending_);
+        }
+        size_t committed = batch.size();
+        server_->commitEntries(batch, static_cast<size_t>(id_));
+        pendingCount_ -= committed;
+    }
+}
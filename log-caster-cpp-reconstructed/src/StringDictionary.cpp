@@ -0,0 +1,52 @@
+// [SEQUENCE: CPP-MVP7-238]
+#include "StringDictionary.h"
+
+namespace {
+const std::string EMPTY;
+}
+
+StringDictionary::StringDictionary() : chunks_(new std::atomic<std::string*>[MAX_CHUNKS]) {
+    for (size_t i = 0; i < MAX_CHUNKS; ++i) {
+        chunks_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+StringDictionary::~StringDictionary() {
+    for (size_t i = 0; i < MAX_CHUNKS; ++i) {
+        delete[] chunks_[i].load(std::memory_order_relaxed);
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-248]
+// 공유 락으로 먼저 찾고, 없을 때만 배타 락을 잡아 다시 확인한 뒤 추가
+uint32_t StringDictionary::intern(std::string_view value) {
+    uint32_t id = find(value);
+    if (id != NONE) return id;
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = ids_.find(value);
+    if (it != ids_.end()) return it->second;
+    id = size_.load(std::memory_order_relaxed);
+    if (id >= CHUNK_SIZE * MAX_CHUNKS) return NONE;
+    std::string* chunk = chunks_[id / CHUNK_SIZE].load(std::memory_order_relaxed);
+    if (!chunk) {
+        chunk = new std::string[CHUNK_SIZE];
+        chunks_[id / CHUNK_SIZE].store(chunk, std::memory_order_release);
+    }
+    std::string& stored = chunk[id % CHUNK_SIZE];
+    stored.assign(value);
+    ids_.emplace(stored, id);
+    size_.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+uint32_t StringDictionary::find(std::string_view value) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = ids_.find(value);
+    return it != ids_.end() ? it->second : NONE;
+}
+
+const std::string& StringDictionary::lookup(uint32_t id) const {
+    if (id >= size_.load(std::memory_order_acquire)) return EMPTY;
+    return chunks_[id / CHUNK_SIZE].load(std::memory_order_acquire)[id % CHUNK_SIZE];
+}
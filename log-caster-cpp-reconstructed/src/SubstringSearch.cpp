@@ -0,0 +1,189 @@
+// [SEQUENCE: CPP-MVP7-359]
+#include "SubstringSearch.h"
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SUBSTRING_SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+using Kernel = size_t (*)(const char*, size_t, const char*, size_t);
+
+// 벡터 블록 하나보다 짧은 본문과 벡터 커널이 없는 환경
+size_t findScalar(const char* haystack, size_t size, const char* needle, size_t length) {
+    return std::string_view(haystack, size).find(std::string_view(needle, length));
+}
+
+// [SEQUENCE: CPP-MVP7-371]
+// bytes 중 하나가 처음 나오는 위치. 벡터 블록 하나보다 짧은 본문과 집합이 큰 경우
+size_t findAnyScalar(const char* haystack, size_t size, const char* bytes, size_t count) {
+    for (size_t i = 0; i < size; ++i) {
+        if (std::memchr(bytes, haystack[i], count)) return i;
+    }
+    return std::string_view::npos;
+}
+
+#ifdef SUBSTRING_SEARCH_X86
+// [SEQUENCE: CPP-MVP7-360]
+// 블록의 first/last 바이트가 모두 맞는 자리의 비트 마스크를 낮은 비트부터 확인.
+// 첫/끝 바이트는 이미 맞았으므로 가운데 length - 2 바이트만 비교
+inline size_t verify(uint32_t mask, const char* haystack, size_t offset, const char* needle, size_t length) {
+    while (mask) {
+        size_t at = offset + __builtin_ctz(mask);
+        if (length <= 2 || std::memcmp(haystack + at + 1, needle + 1, length - 2) == 0) return at;
+        mask &= mask - 1;
+    }
+    return std::string_view::npos;
+}
+
+// at부터 블록 폭만큼의 자리 중 첫 바이트와 (length - 1칸 뒤) 끝 바이트가 모두 맞는 자리의 비트 마스크
+__attribute__((target("sse2")))
+inline uint32_t blockSse2(const char* at, size_t length, __m128i first, __m128i last) {
+    __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(at));
+    __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(at + length - 1));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last))));
+}
+
+__attribute__((target("avx2")))
+inline uint32_t blockAvx2(const char* at, size_t length, __m256i first, __m256i last) {
+    __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at));
+    __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at + length - 1));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi8(head, first), _mm256_cmpeq_epi8(tail, last))));
+}
+
+// 마지막 블록은 본문 끝에 맞춰 겹쳐 읽고, 이미 본 자리의 비트를 지움.
+// 블록 하나보다 짧은 본문은 더 작은 커널로 넘김
+__attribute__((target("sse2")))
+size_t findSse2(const char* haystack, size_t size, const char* needle, size_t length) {
+    constexpr size_t WIDTH = 16;
+    if (size < length - 1 + WIDTH) return findScalar(haystack, size, needle, length);
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[length - 1]);
+    size_t end = size - length + 1;
+    size_t i = 0;
+    for (; i + WIDTH <= end; i += WIDTH) {
+        size_t at = verify(blockSse2(haystack + i, length, first, last), haystack, i, needle, length);
+        if (at != std::string_view::npos) return at;
+    }
+    if (i == end) return std::string_view::npos;
+    size_t from = end - WIDTH;
+    return verify(blockSse2(haystack + from, length, first, last) & (~0u << (i - from)), haystack, from, needle, length);
+}
+
+__attribute__((target("avx2")))
+size_t findAvx2(const char* haystack, size_t size, const char* needle, size_t length) {
+    constexpr size_t WIDTH = 32;
+    if (size < length - 1 + WIDTH) return findSse2(haystack, size, needle, length);
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[length - 1]);
+    size_t end = size - length + 1;
+    size_t i = 0;
+    for (; i + WIDTH <= end; i += WIDTH) {
+        size_t at = verify(blockAvx2(haystack + i, length, first, last), haystack, i, needle, length);
+        if (at != std::string_view::npos) return at;
+    }
+    if (i == end) return std::string_view::npos;
+    size_t from = end - WIDTH;
+    return verify(blockAvx2(haystack + from, length, first, last) & (~0u << (i - from)), haystack, from, needle, length);
+}
+
+// [SEQUENCE: CPP-MVP7-372]
+// 집합의 바이트마다 채운 레지스터와 비교한 결과를 OR해 블록에서 집합 바이트가 있는 자리의 비트 마스크를 얻음
+__attribute__((target("sse2")))
+inline uint32_t anyBlockSse2(const char* at, const __m128i* bytes, size_t count) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(at));
+    __m128i hits = _mm_cmpeq_epi8(block, bytes[0]);
+    for (size_t k = 1; k < count; ++k) hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, bytes[k]));
+    return static_cast<uint32_t>(_mm_movemask_epi8(hits));
+}
+
+__attribute__((target("avx2")))
+inline uint32_t anyBlockAvx2(const char* at, const __m256i* bytes, size_t count) {
+    __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at));
+    __m256i hits = _mm256_cmpeq_epi8(block, bytes[0]);
+    for (size_t k = 1; k < count; ++k) hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, bytes[k]));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(hits));
+}
+
+__attribute__((target("sse2")))
+size_t findAnySse2(const char* haystack, size_t size, const char* bytes, size_t count) {
+    constexpr size_t WIDTH = 16;
+    if (size < WIDTH) return findAnyScalar(haystack, size, bytes, count);
+    __m128i broadcast[SubstringSearch::MAX_ANY_BYTES];
+    for (size_t k = 0; k < count; ++k) broadcast[k] = _mm_set1_epi8(bytes[k]);
+    size_t i = 0;
+    for (; i + WIDTH <= size; i += WIDTH) {
+        uint32_t mask = anyBlockSse2(haystack + i, broadcast, count);
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    if (i == size) return std::string_view::npos;
+    size_t from = size - WIDTH;
+    uint32_t mask = anyBlockSse2(haystack + from, broadcast, count) & (~0u << (i - from));
+    return mask ? from + __builtin_ctz(mask) : std::string_view::npos;
+}
+
+__attribute__((target("avx2")))
+size_t findAnyAvx2(const char* haystack, size_t size, const char* bytes, size_t count) {
+    constexpr size_t WIDTH = 32;
+    if (size < WIDTH) return findAnySse2(haystack, size, bytes, count);
+    __m256i broadcast[SubstringSearch::MAX_ANY_BYTES];
+    for (size_t k = 0; k < count; ++k) broadcast[k] = _mm256_set1_epi8(bytes[k]);
+    size_t i = 0;
+    for (; i + WIDTH <= size; i += WIDTH) {
+        uint32_t mask = anyBlockAvx2(haystack + i, broadcast, count);
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    if (i == size) return std::string_view::npos;
+    size_t from = size - WIDTH;
+    uint32_t mask = anyBlockAvx2(haystack + from, broadcast, count) & (~0u << (i - from));
+    return mask ? from + __builtin_ctz(mask) : std::string_view::npos;
+}
+#endif
+
+// [SEQUENCE: CPP-MVP7-361]
+// 커널 선택은 처음 한 번만 (정적 지역 변수 초기화는 스레드 안전)
+struct Selected {
+    Kernel kernel;
+    Kernel anyOf;
+    const char* name;
+};
+
+const Selected& selected() {
+    static const Selected chosen = [] {
+#ifdef SUBSTRING_SEARCH_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return Selected{findAvx2, findAnyAvx2, "avx2"};
+        if (__builtin_cpu_supports("sse2")) return Selected{findSse2, findAnySse2, "sse2"};
+#endif
+        return Selected{findScalar, findAnyScalar, "scalar"};
+    }();
+    return chosen;
+}
+
+} // namespace
+
+// 한 바이트짜리는 memchr가 더 빠르고, 본문보다 긴 needle은 벡터 커널의 경계 계산 전에 걸러 냄
+size_t SubstringSearch::find(std::string_view haystack, std::string_view needle) {
+    if (needle.empty()) return 0;
+    if (needle.size() > haystack.size()) return std::string_view::npos;
+    if (needle.size() == 1) {
+        const void* at = std::memchr(haystack.data(), needle[0], haystack.size());
+        return at ? static_cast<const char*>(at) - haystack.data() : std::string_view::npos;
+    }
+    return selected().kernel(haystack.data(), haystack.size(), needle.data(), needle.size());
+}
+
+size_t SubstringSearch::findAnyOf(std::string_view haystack, std::string_view bytes) {
+    if (bytes.empty()) return std::string_view::npos;
+    if (bytes.size() == 1) return find(haystack, bytes);
+    if (bytes.size() > MAX_ANY_BYTES) return findAnyScalar(haystack.data(), haystack.size(), bytes.data(), bytes.size());
+    return selected().anyOf(haystack.data(), haystack.size(), bytes.data(), bytes.size());
+}
+
+const char* SubstringSearch::kernelName() {
+    return selected().name;
+}
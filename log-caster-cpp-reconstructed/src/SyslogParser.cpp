@@ -0,0 +1,143 @@
+// [SEQUENCE: CPP-MVP7-101]
+#include "SyslogParser.h"
+#include "LineFramer.h"
+#include <cctype>
+#include <cstring>
+#include <string_view>
+
+namespace {
+
+// 공백 하나까지를 토큰으로 잘라냄
+std::string_view nextToken(std::string_view& in) {
+    size_t sp = in.find(' ');
+    std::string_view token = in.substr(0, sp);
+    in.remove_prefix(sp == std::string_view::npos ? in.size() : sp + 1);
+    return token;
+}
+
+std::string nilToEmpty(std::string_view field) {
+    return field == "-" ? std::string() : std::string(field);
+}
+
+// [SEQUENCE: CPP-MVP7-102]
+// RFC 3164 TIMESTAMP ("Mmm dd hh:mm:ss ") 형식 확인
+bool isBsdTimestamp(std::string_view in) {
+    static const char* months = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    if (in.size() < 16 || in[3] != ' ' || in[6] != ' ' || in[9] != ':' || in[12] != ':' || in[15] != ' ') {
+        return false;
+    }
+    for (int m = 0; m < 12; ++m) {
+        if (in.compare(0, 3, months + m * 3, 3) == 0) return true;
+    }
+    return false;
+}
+
+// [SEQUENCE: CPP-MVP7-103]
+// RFC 5424 STRUCTURED-DATA 건너뛰기 ("-" 또는 "[...]" 반복, 이스케이프 고려)
+void skipStructuredData(std::string_view& in) {
+    if (!in.empty() && in[0] == '-') {
+        in.remove_prefix(1);
+    } else {
+        while (!in.empty() && in[0] == '[') {
+            size_t i = 1;
+            while (i < in.size() && in[i] != ']') {
+                i += (in[i] == '\\') ? 2 : 1;
+            }
+            in.remove_prefix(i < in.size() ? i + 1 : in.size());
+        }
+    }
+    if (!in.empty() && in[0] == ' ') in.remove_prefix(1);
+}
+
+// [SEQUENCE: CPP-MVP7-104]
+// RFC 3164 TAG ("app[pid]: " 또는 "app: ") 추출. TAG가 아니면 빈 문자열
+std::string_view takeTag(std::string_view& in) {
+    size_t i = 0;
+    while (i < in.size() && i <= 48 && in[i] != ':' && in[i] != '[' && in[i] != ' ') i++;
+    if (i == 0 || i >= in.size() || in[i] == ' ') return {};
+    std::string_view tag = in.substr(0, i);
+    std::string_view rest = in.substr(i);
+    if (rest[0] == '[') {
+        size_t close = rest.find(']');
+        if (close == std::string_view::npos) return {};
+        rest.remove_prefix(close + 1);
+    }
+    if (rest.empty() || rest[0] != ':') return {};
+    rest.remove_prefix(1);
+    if (!rest.empty() && rest[0] == ' ') rest.remove_prefix(1);
+    in = rest;
+    return tag;
+}
+
+} // namespace
+
+// [SEQUENCE: CPP-MVP7-105]
+const char* SyslogParser::severityLevel(int severity) {
+    if (severity <= 3) return "ERROR";   // emerg, alert, crit, err
+    if (severity == 4) return "WARN";
+    if (severity <= 6) return "INFO";    // notice, info
+    return "DEBUG";
+}
+
+// [SEQUENCE: CPP-MVP7-106]
+LogEntry SyslogParser::parse(const char* data, size_t len, const std::string& peer) {
+    std::string_view in(data, len);
+    while (!in.empty() && (in.back() == '\n' || in.back() == '\r' || in.back() == '\0')) {
+        in.remove_suffix(1);
+    }
+
+    // PRI: "<0>" ~ "<191>"
+    int pri = -1;
+    if (in.size() >= 3 && in[0] == '<') {
+        size_t close = in.find('>');
+        if (close >= 2 && close <= 4) {
+            int value = 0;
+            bool digits = true;
+            for (size_t i = 1; i < close; ++i) {
+                if (!std::isdigit(static_cast<unsigned char>(in[i]))) { digits = false; break; }
+                value = value * 10 + (in[i] - '0');
+            }
+            if (digits && value <= 191) {
+                pri = value;
+                in.remove_prefix(close + 1);
+            }
+        }
+    }
+
+    // PRI가 없으면 RFC 3164 기본값(user.notice)
+    std::string level = severityLevel(pri < 0 ? 5 : (pri & 7));
+    std::string host;
+    std::string app;
+
+    if (pri >= 0 && in.size() >= 2 && in[0] == '1' && in[1] == ' ') {
+        // RFC 5424: VERSION TIMESTAMP HOSTNAME APP-NAME PROCID MSGID SD MSG
+        in.remove_prefix(2);
+        nextToken(in);                  // TIMESTAMP
+        host = nilToEmpty(nextToken(in));
+        app = nilToEmpty(nextToken(in));
+        nextToken(in);                  // PROCID
+        nextToken(in);                  // MSGID
+        skipStructuredData(in);
+        if (in.size() >= 3 && std::memcmp(in.data(), "\xEF\xBB\xBF", 3) == 0) {
+            in.remove_prefix(3);        // UTF-8 BOM
+        }
+    } else if (pri >= 0) {
+        // RFC 3164: TIMESTAMP HOSTNAME TAG: MSG (HOSTNAME을 생략하는 송신자도 있음)
+        if (isBsdTimestamp(in)) {
+            in.remove_prefix(16);
+            std::string_view probe = in;
+            std::string_view hostToken = nextToken(probe);
+            if (!hostToken.empty() && hostToken.back() != ':' && hostToken.find('[') == std::string_view::npos) {
+                host = std::string(hostToken);
+                in = probe;
+            }
+        }
+        app = std::string(takeTag(in));
+    }
+
+    // [SEQUENCE: CPP-MVP7-389]
+    // MSG 안의 줄바꿈은 텍스트 수집 경로와 같이 한 줄로 만듦
+    std::string message(in);
+    LineFramer::flattenLineBreaks(message);
+    return LogEntry(std::move(message), std::move(level), host.empty() ? peer : std::move(host), std::move(app));
+}
@@ -0,0 +1,270 @@
+// [SEQUENCE: CPP-MVP7-298]
+#include "TokenIndex.h"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <mutex>
+
+namespace {
+uint32_t hashOf(std::string_view token) {
+    uint64_t hash = std::hash<std::string_view>{}(token);
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+}
+}
+
+template <typename Visit>
+void TokenIndex::forEachToken(std::string_view message, Visit visit) {
+    for (size_t i = 0; i < message.size();) {
+        if (!isTokenChar(static_cast<unsigned char>(message[i]))) {
+            ++i;
+            continue;
+        }
+        size_t end = i;
+        while (end < message.size() && isTokenChar(static_cast<unsigned char>(message[end]))) ++end;
+        visit(message.substr(i, end - i), i, end);
+        i = end;
+    }
+}
+
+bool TokenIndex::indexed(std::string_view token) {
+    return token.size() <= MAX_NUMERIC_TOKEN ||
+           std::any_of(token.begin(), token.end(), [](char c) { return c < '0' || c > '9'; });
+}
+
+uint32_t TokenIndex::find(std::string_view token) const {
+    if (table_.empty()) return NONE;
+    uint32_t hash = hashOf(token);
+    size_t mask = table_.size() - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        uint64_t entry = table_[i];
+        if (entry == EMPTY) return NONE;
+        uint32_t id = static_cast<uint32_t>(entry);
+        if (static_cast<uint32_t>(entry >> 32) == hash && tokenOf(terms_[id]) == token) return id;
+    }
+}
+
+void TokenIndex::insertSlot(uint32_t hash, uint32_t id) {
+    size_t mask = table_.size() - 1;
+    size_t i = hash & mask;
+    while (table_[i] != EMPTY) i = (i + 1) & mask;
+    table_[i] = (static_cast<uint64_t>(hash) << 32) | id;
+}
+
+// 없으면 어휘 버퍼 끝에 붙이고 새 id 부여. 표는 절반 넘게 차면 두 배로 늘림
+uint32_t TokenIndex::intern(std::string_view token) {
+    uint32_t id = find(token);
+    if (id != NONE) return id;
+    if ((terms_.size() + 1) * 2 > table_.size()) {
+        std::vector<uint64_t> old(std::max<size_t>(1024, table_.size() * 2), EMPTY);
+        old.swap(table_);
+        for (uint64_t entry : old) {
+            if (entry != EMPTY) insertSlot(static_cast<uint32_t>(entry >> 32), static_cast<uint32_t>(entry));
+        }
+    }
+    id = static_cast<uint32_t>(terms_.size());
+    vocabulary_.push_back('\0');
+    terms_.push_back({vocabulary_.size(), static_cast<uint32_t>(token.size())});
+    vocabulary_.append(token);
+    insertSlot(hashOf(token), id);
+    return id;
+}
+
+// 메시지의 서로 다른 토큰마다 순번을 뒤에 붙임 (순번은 호출마다 증가하므로 목록은 정렬 상태 유지)
+void TokenIndex::add(uint64_t sequence, std::string_view message) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    latest_ = sequence;
+    scratch_.clear();
+    size_t known = terms_.size();
+    forEachToken(message, [this](std::string_view token, size_t, size_t) {
+        if (indexed(token)) scratch_.push_back(intern(token));
+    });
+    std::sort(scratch_.begin(), scratch_.end());
+    scratch_.erase(std::unique(scratch_.begin(), scratch_.end()), scratch_.end());
+    for (uint32_t id : scratch_) {
+        Term& term = terms_[id];
+        if (id < known && term.live() == 0) deadTerms_--;
+        term.postings.push_back(static_cast<uint32_t>(sequence));
+    }
+    postingCount_ += scratch_.size();
+    updateStats();
+}
+
+// 밀려난 항목은 목록 맨 앞이므로 앞 위치만 옮기고, 중간 제거된 항목은 이분 탐색으로 찾아 지움
+void TokenIndex::remove(uint64_t sequence, std::string_view message) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    uint32_t stored = static_cast<uint32_t>(sequence);
+    scratch_.clear();
+    forEachToken(message, [this](std::string_view token, size_t, size_t) {
+        uint32_t id = indexed(token) ? find(token) : NONE;
+        if (id != NONE) scratch_.push_back(id);
+    });
+    std::sort(scratch_.begin(), scratch_.end());
+    scratch_.erase(std::unique(scratch_.begin(), scratch_.end()), scratch_.end());
+    for (uint32_t id : scratch_) {
+        Term& term = terms_[id];
+        if (term.live() == 0) continue;
+        if (term.postings[term.front] == stored) {
+            term.front++;
+        } else {
+            // 저장값은 32비트에서 감기므로 맨 앞 항목과의 차이로 비교
+            uint32_t base = term.postings[term.front];
+            auto begin = term.postings.begin() + term.front;
+            auto it = std::lower_bound(begin, term.postings.end(), stored, [base](uint32_t a, uint32_t b) {
+                return static_cast<uint32_t>(a - base) < static_cast<uint32_t>(b - base);
+            });
+            if (it == term.postings.end() || *it != stored) continue;
+            term.postings.erase(it);
+        }
+        postingCount_--;
+        if (term.live() == 0) {
+            dropTerm(id);
+        } else if (term.front >= 64 && term.front * 2 >= term.postings.size()) {
+            term.postings.erase(term.postings.begin(), term.postings.begin() + term.front);
+            term.front = 0;
+        }
+    }
+    if (deadTerms_ > 1024 && deadTerms_ * 2 > terms_.size()) {
+        rebuildVocabulary();
+    }
+    updateStats();
+}
+
+// 빈 토큰은 어휘에 남겨 두었다가 다시 나오면 재사용 (쌓이면 rebuildVocabulary에서 정리)
+void TokenIndex::dropTerm(uint32_t id) {
+    Term& term = terms_[id];
+    std::vector<uint32_t>().swap(term.postings);
+    term.front = 0;
+    deadTerms_++;
+}
+
+// [SEQUENCE: CPP-MVP7-299]
+// 살아 있는 토큰만 순서대로 새 어휘 버퍼에 옮기고 id를 다시 매김
+void TokenIndex::rebuildVocabulary() {
+    std::string vocabulary;
+    std::vector<Term> terms;
+    for (Term& term : terms_) {
+        if (term.live() == 0) continue;
+        vocabulary.push_back('\0');
+        terms.push_back({vocabulary.size(), term.length, term.front, std::move(term.postings)});
+        vocabulary.append(tokenOf(term));
+    }
+    vocabulary_.swap(vocabulary);
+    terms_.swap(terms);
+    deadTerms_ = 0;
+    size_t slots = 1024;
+    while (slots < terms_.size() * 2) slots *= 2;
+    table_.assign(slots, EMPTY);
+    for (size_t id = 0; id < terms_.size(); ++id) {
+        insertSlot(hashOf(tokenOf(terms_[id])), static_cast<uint32_t>(id));
+    }
+}
+
+void TokenIndex::updateStats() {
+    termCount_.store(terms_.size() - deadTerms_, std::memory_order_relaxed);
+    bytes_.store(vocabulary_.capacity() + terms_.capacity() * sizeof(Term) + postingCount_ * sizeof(uint32_t) +
+                     table_.capacity() * sizeof(uint64_t),
+                 std::memory_order_relaxed);
+}
+
+// [SEQUENCE: CPP-MVP7-300]
+// AND는 키워드별 후보의 교집합(좁힐 수 없는 키워드는 건너뜀), OR은 합집합(하나라도 못 좁히면 포기)
+bool TokenIndex::candidates(const std::vector<std::string>& keywords, bool all, size_t limit,
+                            std::vector<uint64_t>& out) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    out.clear();
+    bool narrowed = false;
+    std::vector<uint64_t> matched, merged;
+    for (const auto& keyword : keywords) {
+        if (!match(keyword, limit, matched)) {
+            if (!all) return false;
+            continue;
+        }
+        if (!narrowed) {
+            out.swap(matched);
+            narrowed = true;
+        } else if (all) {
+            merged.clear();
+            std::set_intersection(out.begin(), out.end(), matched.begin(), matched.end(), std::back_inserter(merged));
+            out.swap(merged);
+        } else {
+            merged.clear();
+            std::set_union(out.begin(), out.end(), matched.begin(), matched.end(), std::back_inserter(merged));
+            out.swap(merged);
+            if (out.size() > limit) return false;
+        }
+        if (all && out.empty()) break;
+    }
+    return narrowed;
+}
+
+// 키워드를 토큰 문자 구간으로 나누고, 색인으로 찾을 수 있는 구간을 제약이 큰 순서(양끝 고정 > 한쪽 고정 > 없음, 같으면 긴 것)로
+// 시도해 토큰을 고름:
+//  양끝 고정: 그 토큰 자체, 앞 고정: 그것으로 시작하는 토큰, 뒤 고정: 그것으로 끝나는 토큰, 없음: 그것을 품은 토큰
+bool TokenIndex::match(std::string_view keyword, size_t limit, std::vector<uint64_t>& out) const {
+    std::vector<Run> runs;
+    forEachToken(keyword, [&runs, &keyword](std::string_view token, size_t begin, size_t end) {
+        Run run{token, begin > 0, end < keyword.size()};
+        // 숫자만 있는 구간은 색인하지 않은 긴 숫자 토큰에 들어 있을 수 있으므로 짧은 토큰 전체일 때만 사용
+        if (!std::all_of(token.begin(), token.end(), [](char c) { return c >= '0' && c <= '9'; }) ||
+            (run.startsToken && run.endsToken && token.size() <= MAX_NUMERIC_TOKEN)) {
+            runs.push_back(run);
+        }
+    });
+    std::sort(runs.begin(), runs.end(), [](const Run& a, const Run& b) {
+        int aBound = a.startsToken + a.endsToken, bBound = b.startsToken + b.endsToken;
+        return aBound != bBound ? aBound > bBound : a.text.size() > b.text.size();
+    });
+    // 앞선 구간의 후보가 limit를 넘으면 다음 구간으로 시도
+    std::vector<uint32_t> ids;
+    for (const Run& run : runs) {
+        ids.clear();
+        if (termsFor(run, limit, ids)) {
+            collect(ids, out);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TokenIndex::termsFor(const Run& run, size_t limit, std::vector<uint32_t>& ids) const {
+    if (run.startsToken && run.endsToken) {
+        uint32_t id = find(run.text);
+        if (id != NONE) ids.push_back(id);
+    } else {
+        std::string_view vocabulary(vocabulary_);
+        size_t hit = vocabulary.find(run.text);
+        while (hit != std::string_view::npos) {
+            // hit이 속한 토큰 (구간에는 구분 문자 '\0'이 없으므로 토큰 경계를 넘지 않음)
+            auto term = std::upper_bound(terms_.begin(), terms_.end(), hit,
+                                         [](size_t offset, const Term& t) { return offset < t.offset; }) - 1;
+            size_t termEnd = term->offset + term->length;
+            if ((!run.startsToken || hit == term->offset) && (!run.endsToken || hit + run.text.size() == termEnd)) {
+                if (term->live() > 0) ids.push_back(static_cast<uint32_t>(term - terms_.begin()));
+                hit = vocabulary.find(run.text, termEnd);
+            } else {
+                hit = vocabulary.find(run.text, hit + 1);
+            }
+        }
+    }
+    size_t total = 0;
+    for (uint32_t id : ids) {
+        total += terms_[id].live();
+        if (total > limit) return false;
+    }
+    return true;
+}
+
+void TokenIndex::collect(const std::vector<uint32_t>& ids, std::vector<uint64_t>& out) const {
+    out.clear();
+    for (uint32_t id : ids) {
+        const Term& term = terms_[id];
+        for (size_t i = term.front; i < term.postings.size(); ++i) {
+            out.push_back(widen(term.postings[i]));
+        }
+    }
+    if (ids.size() > 1) {
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+}
@@ -0,0 +1,158 @@
+// [SEQUENCE: CPP-MVP7-313]
+#include "TrigramIndex.h"
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+
+// 바이트 부류: 영문자(대소문자 같음) 1~26, 숫자 27~36, 식별자에 흔한 구두점 37~45,
+// 그 밖의 바이트(UTF-8 포함)는 남은 부류에 나눠 담음
+uint32_t TrigramIndex::classOf(unsigned char c) {
+    if ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') return 1 + ((c | 0x20) - 'a');
+    if (c >= '0' && c <= '9') return 27 + (c - '0');
+    switch (c) {
+        case ' ': return 37;
+        case '-': return 38;
+        case '_': return 39;
+        case '.': return 40;
+        case ':': return 41;
+        case '/': return 42;
+        case '=': return 43;
+        case '@': return 44;
+        case ',': return 45;
+        default: return 46 + c % 18;
+    }
+}
+
+// 블록마다 조합이 처음 나올 때만 목록에 블록 번호를 붙임 (표는 처음 쓸 때 할당)
+void TrigramIndex::add(uint64_t sequence, std::string_view message) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (slots_.empty()) slots_.resize(KEYS);
+    latest_ = sequence;
+    uint32_t block = static_cast<uint32_t>(sequence / BLOCK_ENTRIES);
+    uint32_t key = 0;
+    for (size_t i = 0; i < message.size(); ++i) {
+        key = nextKey(key, message[i]);
+        if (i < 2) continue;
+        Slot& slot = slots_[key];
+        if (slot.lastBlock == block && slot.list != NONE) continue;
+        slot.lastBlock = block;
+        if (slot.list == NONE) {
+            slot.list = static_cast<uint32_t>(lists_.size());
+            lists_.emplace_back();
+        }
+        List& list = lists_[slot.list];
+        trim(list);
+        if (list.live() == 0) liveLists_++;
+        list.blocks.push_back(block);
+        postingCount_++;
+    }
+    updateStats();
+}
+
+// [SEQUENCE: CPP-MVP7-314]
+// 가장 오래된 블록이 바뀔 때마다 SWEEP_LISTS개 목록의 앞을 잘라 냄
+void TrigramIndex::evict(uint64_t sequence) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    uint64_t before = oldest_ / BLOCK_ENTRIES;
+    oldest_ = std::max(oldest_, sequence + 1);
+    if (oldest_ / BLOCK_ENTRIES == before || lists_.empty()) return;
+    for (size_t i = 0; i < SWEEP_LISTS && i < lists_.size(); ++i) {
+        sweep_ = (sweep_ + 1) % lists_.size();
+        trim(lists_[sweep_]);
+    }
+    updateStats();
+}
+
+void TrigramIndex::trim(List& list) {
+    uint64_t oldestBlock = oldest_ / BLOCK_ENTRIES;
+    size_t front = list.front;
+    while (front < list.blocks.size() && widen(list.blocks[front]) < oldestBlock) ++front;
+    postingCount_ -= front - list.front;
+    list.front = static_cast<uint32_t>(front);
+    if (list.live() == 0) {
+        if (!list.blocks.empty()) liveLists_--;
+        std::vector<uint32_t>().swap(list.blocks);
+        list.front = 0;
+    } else if (list.front >= 64 && list.front * 2 >= list.blocks.size()) {
+        list.blocks.erase(list.blocks.begin(), list.blocks.begin() + list.front);
+        list.front = 0;
+    }
+}
+
+void TrigramIndex::updateStats() {
+    trigramCount_.store(liveLists_, std::memory_order_relaxed);
+    bytes_.store(slots_.capacity() * sizeof(Slot) + lists_.capacity() * sizeof(List) +
+                     postingCount_ * sizeof(uint32_t),
+                 std::memory_order_relaxed);
+}
+
+// [SEQUENCE: CPP-MVP7-315]
+// 조합별 블록 목록을 짧은 것부터 교집합 (없는 조합이 하나라도 있으면 빈 결과)
+bool TrigramIndex::blocksFor(std::string_view literal, std::vector<uint64_t>& blocks) const {
+    blocks.clear();
+    if (literal.size() < 3) return false;
+    std::vector<const List*> lists;
+    uint32_t key = 0;
+    for (size_t i = 0; i < literal.size(); ++i) {
+        key = nextKey(key, literal[i]);
+        if (i < 2) continue;
+        const Slot* slot = slots_.empty() ? nullptr : &slots_[key];
+        if (!slot || slot->list == NONE || lists_[slot->list].live() == 0) return true;
+        lists.push_back(&lists_[slot->list]);
+    }
+    std::sort(lists.begin(), lists.end());
+    lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+    std::sort(lists.begin(), lists.end(), [](const List* a, const List* b) { return a->live() < b->live(); });
+
+    uint64_t oldestBlock = oldest_ / BLOCK_ENTRIES;
+    for (size_t i = lists[0]->front; i < lists[0]->blocks.size(); ++i) {
+        uint64_t block = widen(lists[0]->blocks[i]);
+        if (block >= oldestBlock) blocks.push_back(block);
+    }
+    std::vector<uint64_t> next, merged;
+    for (size_t l = 1; l < lists.size() && !blocks.empty(); ++l) {
+        next.clear();
+        for (size_t i = lists[l]->front; i < lists[l]->blocks.size(); ++i) {
+            next.push_back(widen(lists[l]->blocks[i]));
+        }
+        merged.clear();
+        std::set_intersection(blocks.begin(), blocks.end(), next.begin(), next.end(), std::back_inserter(merged));
+        blocks.swap(merged);
+    }
+    blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+    return true;
+}
+
+// 문자열별 블록을 교집합(all) 또는 합집합으로 모은 뒤 살아 있는 순번 범위로 펼침
+bool TrigramIndex::candidates(const std::vector<std::string>& required, bool all, size_t limit,
+                              std::vector<uint64_t>& out) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    out.clear();
+    bool narrowed = false;
+    std::vector<uint64_t> blocks, found, merged;
+    for (const auto& literal : required) {
+        if (!blocksFor(literal, found)) {
+            if (!all) return false;
+            continue;
+        }
+        merged.clear();
+        if (!narrowed) {
+            merged.swap(found);
+        } else if (all) {
+            std::set_intersection(blocks.begin(), blocks.end(), found.begin(), found.end(), std::back_inserter(merged));
+        } else {
+            std::set_union(blocks.begin(), blocks.end(), found.begin(), found.end(), std::back_inserter(merged));
+        }
+        blocks.swap(merged);
+        narrowed = true;
+        if (blocks.size() * BLOCK_ENTRIES > limit + 2 * BLOCK_ENTRIES) return false;
+    }
+    if (!narrowed) return false;
+    for (uint64_t block : blocks) {
+        uint64_t first = std::max(block * BLOCK_ENTRIES, oldest_);
+        uint64_t last = std::min((block + 1) * BLOCK_ENTRIES, latest_ + 1);
+        for (uint64_t sequence = first; sequence < last; ++sequence) out.push_back(sequence);
+        if (out.size() > limit) return false;
+    }
+    return true;
+}
@@ -0,0 +1,475 @@
+// [SEQUENCE: CPP-MVP7-61]
+#include "UringReactor.h"
+#include "LogServer.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/eventfd.h>
+#include <sys/utsname.h>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <linux/time_types.h>
+#endif
+
+#if defined(IORING_RECV_MULTISHOT) && defined(IORING_ACCEPT_MULTISHOT) && defined(__NR_io_uring_setup)
+#define LOGCASTER_HAVE_IO_URING 1
+#endif
+
+#ifdef LOGCASTER_HAVE_IO_URING
+
+namespace {
+int sysSetup(unsigned entries, io_uring_params* params) {
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int sysEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+int sysRegister(int fd, unsigned opcode, void* arg, unsigned nrArgs) {
+    return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs));
+}
+
+// [SEQUENCE: CPP-MVP7-62]
+// multishot recv는 6.0, provided buffer ring은 5.19부터 지원
+bool kernelSupportsMultishot() {
+    utsname info {};
+    if (uname(&info) != 0) return false;
+    int major = 0, minor = 0;
+    if (std::sscanf(info.release, "%d.%d", &major, &minor) != 2) return false;
+    return major > 6 || (major == 6 && minor >= 0);
+}
+}
+
+// [SEQUENCE: CPP-MVP7-63]
+// 생성자: 링, 버퍼 링, wakeup eventfd 구성. 실패 시 자원을 정리하고 예외
+UringReactor::UringReactor(LogServer* server, int id)
+    : Reactor(server, id), ringFd_(-1), wakeupFd_(-1), wakeValue_(0),
+      sqRingPtr_(MAP_FAILED), sqRingSize_(0), cqRingPtr_(MAP_FAILED), cqRingSize_(0),
+      sqes_(nullptr), sqesSize_(0),
+      sqHead_(nullptr), sqTail_(nullptr), sqMask_(nullptr), sqArray_(nullptr),
+      sqEntries_(0), sqLocalTail_(0), sqSubmittedTail_(0),
+      cqHead_(nullptr), cqTail_(nullptr), cqMask_(nullptr), cqes_(nullptr),
+      bufRing_(nullptr), bufRingTail_(nullptr), bufRingSize_(0), bufferPool_(nullptr), bufTail_(0),
+      nextConnId_(1), resumeTimeout_{0, 0}, timeoutArmed_(false) {
+    if (!kernelSupportsMultishot()) {
+        throw std::runtime_error("kernel too old for multishot recv");
+    }
+    try {
+        setupRing();
+        setupBufferRing();
+        // 링이 직접 읽으므로 블로킹 eventfd 사용
+        wakeupFd_ = eventfd(0, EFD_CLOEXEC);
+        if (wakeupFd_ < 0) throw std::runtime_error("eventfd failed");
+    } catch (...) {
+        teardown();
+        throw;
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-64]
+// 소멸자: 스레드 종료 후 연결을 닫고 링을 해제 (링을 닫으면 남은 요청은 커널이 취소)
+UringReactor::~UringReactor() {
+    stop();
+    join();
+    closeAllConnections();
+    teardown();
+}
+
+void UringReactor::teardown() {
+    if (bufferPool_) {
+        munmap(bufferPool_, static_cast<size_t>(BUFFER_COUNT) * BUFFER_SIZE);
+        bufferPool_ = nullptr;
+    }
+    if (bufRing_) {
+        munmap(bufRing_, bufRingSize_);
+        bufRing_ = nullptr;
+    }
+    if (sqes_) {
+        munmap(sqes_, sqesSize_);
+        sqes_ = nullptr;
+    }
+    if (cqRingPtr_ != MAP_FAILED && cqRingPtr_ != sqRingPtr_) {
+        munmap(cqRingPtr_, cqRingSize_);
+    }
+    cqRingPtr_ = MAP_FAILED;
+    if (sqRingPtr_ != MAP_FAILED) {
+        munmap(sqRingPtr_, sqRingSize_);
+        sqRingPtr_ = MAP_FAILED;
+    }
+    if (ringFd_ != -1) {
+        close(ringFd_);
+        ringFd_ = -1;
+    }
+    if (wakeupFd_ != -1) {
+        close(wakeupFd_);
+        wakeupFd_ = -1;
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-65]
+// io_uring_setup 후 SQ/CQ 링과 SQE 배열을 매핑
+void UringReactor::setupRing() {
+    io_uring_params params {};
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = RING_ENTRIES * 4;
+    ringFd_ = sysSetup(RING_ENTRIES, &params);
+    if (ringFd_ < 0) {
+        throw std::runtime_error(std::string("io_uring_setup: ") + strerror(errno));
+    }
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !(params.features & IORING_FEAT_NODROP)) {
+        throw std::runtime_error("required io_uring features missing");
+    }
+
+    sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    sqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+    sqRingPtr_ = mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ringFd_, IORING_OFF_SQ_RING);
+    if (sqRingPtr_ == MAP_FAILED) throw std::runtime_error("mmap SQ ring failed");
+    cqRingPtr_ = sqRingPtr_;
+
+    sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      ringFd_, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) throw std::runtime_error("mmap SQEs failed");
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    char* sq = static_cast<char*>(sqRingPtr_);
+    sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sqMask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    sqEntries_ = params.sq_entries;
+    sqLocalTail_ = sqSubmittedTail_ = *sqTail_;
+
+    char* cq = static_cast<char*>(cqRingPtr_);
+    cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cqMask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+}
+
+// [SEQUENCE: CPP-MVP7-66]
+// provided buffer ring 등록 후 모든 수신 버퍼를 커널에 제공
+void UringReactor::setupBufferRing() {
+    bufRingSize_ = BUFFER_COUNT * sizeof(io_uring_buf);
+    void* ring = mmap(nullptr, bufRingSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ring == MAP_FAILED) throw std::runtime_error("mmap buffer ring failed");
+    // C++에서는 io_uring_buf_ring의 flexible array 오프셋이 C와 달라지므로
+    // 링을 io_uring_buf 배열로 직접 다루고 tail은 첫 항목의 resv 위치를 사용
+    bufRing_ = static_cast<io_uring_buf*>(ring);
+    bufRingTail_ = &bufRing_[0].resv;
+
+    void* pool = mmap(nullptr, static_cast<size_t>(BUFFER_COUNT) * BUFFER_SIZE, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pool == MAP_FAILED) throw std::runtime_error("mmap buffer pool failed");
+    bufferPool_ = static_cast<char*>(pool);
+
+    io_uring_buf_reg reg {};
+    reg.ring_addr = reinterpret_cast<uint64_t>(bufRing_);
+    reg.ring_entries = BUFFER_COUNT;
+    reg.bgid = BUFFER_GROUP;
+    if (sysRegister(ringFd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+        throw std::runtime_error(std::string("IORING_REGISTER_PBUF_RING: ") + strerror(errno));
+    }
+
+    bufTail_ = 0;
+    for (unsigned i = 0; i < BUFFER_COUNT; ++i) {
+        recycleBuffer(static_cast<uint16_t>(i));
+    }
+    __atomic_store_n(bufRingTail_, bufTail_, __ATOMIC_RELEASE);
+}
+
+// [SEQUENCE: CPP-MVP7-67]
+// 소비한 버퍼를 링에 되돌림 (tail 공개는 완료 배치 처리 후 한 번에)
+void UringReactor::recycleBuffer(uint16_t bid) {
+    io_uring_buf* buf = &bufRing_[bufTail_ & (BUFFER_COUNT - 1)];
+    buf->addr = reinterpret_cast<uint64_t>(bufferPool_ + static_cast<size_t>(bid) * BUFFER_SIZE);
+    buf->len = BUFFER_SIZE;
+    buf->bid = bid;
+    bufTail_++;
+}
+
+void UringReactor::wake() {
+    uint64_t one = 1;
+    ssize_t ignored = write(wakeupFd_, &one, sizeof(one));
+    (void)ignored;
+}
+
+// [SEQUENCE: CPP-MVP7-68]
+// 리스너 등록. accept 요청은 리액터 스레드가 run()에서 제출
+void UringReactor::addListener(int fd, Protocol protocol) {
+    listeners_.push_back({fd, protocol});
+}
+
+// [SEQUENCE: CPP-MVP7-69]
+// 빈 SQE 확보. SQ가 가득 차면 먼저 제출
+io_uring_sqe* UringReactor::getSqe() {
+    unsigned head = __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+    if (sqLocalTail_ - head >= sqEntries_) {
+        submitAndWait(0);
+        head = __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+        if (sqLocalTail_ - head >= sqEntries_) return nullptr;
+    }
+    unsigned index = sqLocalTail_ & *sqMask_;
+    io_uring_sqe* sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqArray_[index] = index;
+    sqLocalTail_++;
+    return sqe;
+}
+
+void UringReactor::submitAndWait(unsigned waitNr) {
+    __atomic_store_n(sqTail_, sqLocalTail_, __ATOMIC_RELEASE);
+    unsigned toSubmit = sqLocalTail_ - sqSubmittedTail_;
+    int ret = sysEnter(ringFd_, toSubmit, waitNr, waitNr > 0 ? IORING_ENTER_GETEVENTS : 0);
+    if (ret >= 0) {
+        sqSubmittedTail_ += static_cast<unsigned>(ret);
+    }
+}
+
+void UringReactor::armAccept(size_t listenerIndex) {
+    io_uring_sqe* sqe = getSqe();
+    if (!sqe) return;
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = listeners_[listenerIndex].fd;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+    sqe->user_data = encode(Op::ACCEPT, listenerIndex);
+}
+
+void UringReactor::armRecv(uint64_t connId, int fd) {
+    io_uring_sqe* sqe = getSqe();
+    if (!sqe) return;
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = BUFFER_GROUP;
+    sqe->user_data = encode(Op::RECV, connId);
+}
+
+void UringReactor::armWake() {
+    io_uring_sqe* sqe = getSqe();
+    if (!sqe) return;
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = wakeupFd_;
+    sqe->addr = reinterpret_cast<uint64_t>(&wakeValue_);
+    sqe->len = sizeof(wakeValue_);
+    sqe->user_data = encode(Op::WAKE, 0);
+}
+
+void UringReactor::cancelRecv(uint64_t connId) {
+    io_uring_sqe* sqe = getSqe();
+    if (!sqe) return;
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = encode(Op::RECV, connId);
+    sqe->user_data = encode(Op::CANCEL, connId);
+}
+
+// [SEQUENCE: CPP-MVP7-175]
+// 멈춘 연결이 있는 동안 RESUME_CHECK_MS마다 리액터를 깨우는 단발 타이머
+void UringReactor::armResumeTimeout() {
+    static_assert(sizeof(ResumeTimeout) == sizeof(__kernel_timespec), "timespec layout mismatch");
+    if (timeoutArmed_) return;
+    io_uring_sqe* sqe = getSqe();
+    if (!sqe) return;
+    resumeTimeout_.sec = 0;
+    resumeTimeout_.nsec = static_cast<long long>(std::max(1, resumeTimeoutMs())) * 1000000;
+    sqe->opcode = IORING_OP_TIMEOUT;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<uint64_t>(&resumeTimeout_);
+    sqe->len = 1;
+    sqe->user_data = encode(Op::TIMEOUT, 0);
+    timeoutArmed_ = true;
+}
+
+// 재개: recv가 끝난 연결은 다시 걸고, 취소가 진행 중인 연결은 마지막 완료에서 다시 걸린다
+void UringReactor::resumePaused() {
+    auto now = TokenBucket::Clock::now();
+    for (auto pit = paused_.begin(); pit != paused_.end();) {
+        uint64_t connId = *pit;
+        auto it = connections_.find(connId);
+        if (it != connections_.end() && !resumable(*it->second, now)) {
+            ++pit;
+            continue;
+        }
+        if (it != connections_.end() && parked_.erase(connId)) {
+            armRecv(connId, it->second->fd);
+        }
+        pit = paused_.erase(pit);
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-70]
+// 이벤트 루프: 제출과 대기를 한 번의 io_uring_enter로 처리하고, 완료 큐를 모두 비운 뒤 배치 커밋
+void UringReactor::run() {
+    armWake();
+    for (size_t i = 0; i < listeners_.size(); ++i) {
+        armAccept(i);
+    }
+    while (running_) {
+        submitAndWait(1);
+        processCompletions();
+        flushBatch();
+        if (!paused_.empty()) {
+            resumePaused();
+        }
+        if (!paused_.empty()) {
+            armResumeTimeout();
+        }
+    }
+}
+
+void UringReactor::processCompletions() {
+    unsigned head = *cqHead_;
+    unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+    uint16_t bufTailBefore = bufTail_;
+
+    while (head != tail) {
+        io_uring_cqe cqe = cqes_[head & *cqMask_];
+        head++;
+
+        Op op = static_cast<Op>(cqe.user_data >> 56);
+        uint64_t id = cqe.user_data & ((1ULL << 56) - 1);
+        switch (op) {
+            case Op::ACCEPT:
+                handleAcceptCompletion(cqe, static_cast<size_t>(id));
+                break;
+            case Op::RECV:
+                handleRecvCompletion(cqe, id);
+                break;
+            case Op::WAKE:
+                if (running_) armWake();
+                break;
+            case Op::CANCEL:
+                break;
+            case Op::TIMEOUT:
+                timeoutArmed_ = false;
+                break;
+        }
+        if (head == tail) {
+            tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+        }
+    }
+    __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+    if (bufTail_ != bufTailBefore) {
+        __atomic_store_n(bufRingTail_, bufTail_, __ATOMIC_RELEASE);
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-71]
+// multishot accept 완료: 새 연결을 등록하고 multishot recv를 건다
+void UringReactor::handleAcceptCompletion(const io_uring_cqe& cqe, size_t listenerIndex) {
+    if (cqe.res >= 0) {
+        int fd = cqe.res;
+        uint64_t connId = nextConnId_++;
+        if (!registerConnection(connId, fd, listeners_[listenerIndex].protocol)) {
+            close(fd);
+        } else {
+            armRecv(connId, fd);
+        }
+    }
+    // 커널이 multishot을 종료했으면 다시 건다 (종료 중에는 제외)
+    if (!(cqe.flags & IORING_CQE_F_MORE) && running_) {
+        if (cqe.res >= 0 || cqe.res == -ENFILE || cqe.res == -EMFILE || cqe.res == -EINTR) {
+            armAccept(listenerIndex);
+        }
+    }
+}
+
+// [SEQUENCE: CPP-MVP7-72]
+// multishot recv 완료: 선택된 버퍼의 데이터를 소비하고 즉시 버퍼를 반환
+void UringReactor::handleRecvCompletion(const io_uring_cqe& cqe, uint64_t connId) {
+    auto it = connections_.find(connId);
+    Connection* conn = (it != connections_.end()) ? it->second.get() : nullptr;
+
+    bool wasPaused = paused_.count(connId) > 0;
+    if (cqe.flags & IORING_CQE_F_BUFFER) {
+        uint16_t bid = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+        if (conn && cqe.res > 0 && !detaching_.count(connId)) {
+            const char* data = bufferPool_ + static_cast<size_t>(bid) * BUFFER_SIZE;
+            if (consume(*conn, data, static_cast<size_t>(cqe.res))) {
+                // 쿼리 요청 완료(또는 잘못된 바이너리 프레임): recv를 취소하고 마지막 완료를 받은 뒤 정리
+                detaching_.insert(connId);
+                if (cqe.flags & IORING_CQE_F_MORE) {
+                    cancelRecv(connId);
+                }
+            } else if (!conn->isQuery && !wasPaused) {
+                // [SEQUENCE: CPP-MVP7-176]
+                // BLOCK 정책 또는 속도 제한 DELAY: 이미 받은 데이터는 소비하고 이후 recv를 취소해 소켓에 남겨둠
+                if (!paused_.count(connId) && ingestBlocked()) {
+                    throttleConnection(connId);
+                }
+                if (paused_.count(connId) && (cqe.flags & IORING_CQE_F_MORE)) {
+                    cancelRecv(connId);
+                }
+            }
+        }
+        recycleBuffer(bid);
+    }
+
+    if (cqe.flags & IORING_CQE_F_MORE) return;
+    if (!conn) return;
+
+    // 멈춘 연결은 재개될 때까지 recv를 걸지 않음
+    bool resumable = cqe.res > 0 || cqe.res == -ENOBUFS || cqe.res == -ECANCELED;
+    if (paused_.count(connId) && resumable) {
+        parked_.insert(connId);
+        return;
+    }
+
+    // multishot 종료: 데이터가 남았거나 버퍼 고갈이면 다시 걸고, 그 외에는 연결 종료
+    // (멈춤 취소가 끝나기 전에 재개된 연결은 -ECANCELED로 끝나므로 다시 건다)
+    bool rearm = !detaching_.count(connId) && running_ && resumable;
+    if (rearm) {
+        armRecv(connId, conn->fd);
+        return;
+    }
+    finishConnection(connId);
+}
+
+void UringReactor::finishConnection(uint64_t connId) {
+    detaching_.erase(connId);
+    parked_.erase(connId);
+    auto it = connections_.find(connId);
+    if (it == connections_.end()) return;
+    if (it->second->isQuery) {
+        dispatchQuery(connId);
+    } else {
+        releaseConnection(connId);
+    }
+}
+
+#else // !LOGCASTER_HAVE_IO_URING
+
+// [SEQUENCE: CPP-MVP7-73]
+// io_uring 헤더가 없는 환경: 항상 epoll로 대체되도록 생성자에서 예외
+UringReactor::UringReactor(LogServer* server, int id)
+    : Reactor(server, id), ringFd_(-1), wakeupFd_(-1), wakeValue_(0),
+      sqRingPtr_(nullptr), sqRingSize_(0), cqRingPtr_(nullptr), cqRingSize_(0),
+      sqes_(nullptr), sqesSize_(0),
+      sqHead_(nullptr), sqTail_(nullptr), sqMask_(nullptr), sqArray_(nullptr),
+      sqEntries_(0), sqLocalTail_(0), sqSubmittedTail_(0),
+      cqHead_(nullptr), cqTail_(nullptr), cqMask_(nullptr), cqes_(nullptr),
+      bufRing_(nullptr), bufRingTail_(nullptr), bufRingSize_(0), bufferPool_(nullptr), bufTail_(0),
+      nextConnId_(1), resumeTimeout_{0, 0}, timeoutArmed_(false) {
+    throw std::runtime_error("built without io_uring support");
+}
+
+UringReactor::~UringReactor() = default;
+void UringReactor::addListener(int, Protocol) {}
+void UringReactor::run() {}
+void UringReactor::wake() {}
+
+#endif // LOGCASTER_HAVE_IO_URING
@@ -23,11 +23,34 @@ int main(int argc, char* argv[]) {
     // [SEQUENCE: CPP-MVP6-12]
     bool irc_enabled = false;
     int irc_port = 6667;
+    // [SEQUENCE: CPP-MVP7-44]
+    size_t reactor_count = 1;
+    // [SEQUENCE: CPP-MVP7-77]
+    Reactor::Backend io_backend = Reactor::Backend::EPOLL;
+    // [SEQUENCE: CPP-MVP7-124]
+    int syslog_port = 0;
+    // [SEQUENCE: CPP-MVP7-180]
+    LogBuffer::OverflowPolicy overflow_policy = LogBuffer::OverflowPolicy::DROP_OLDEST;
+    // [SEQUENCE: CPP-MVP7-266]
+    size_t buffer_budget = LogBuffer::DEFAULT_BYTE_BUDGET;
+    // [SEQUENCE: CPP-MVP7-337]
+    LogBuffer::IndexMode index_mode = LogBuffer::IndexMode::FULL;
+    // [SEQUENCE: CPP-MVP7-355]
+    size_t query_threads = std::max(1u, std::thread::hardware_concurrency());
+    // [SEQUENCE: CPP-MVP7-287]
+    SegmentStoreConfig spill_config;
+    // [SEQUENCE: CPP-MVP7-203]
+    RateLimitConfig rate_limit;
+    // [SEQUENCE: CPP-MVP7-155]
+    int binary_port = 0;
+    // [SEQUENCE: CPP-MVP7-136]
+    std::string unix_stream_path;
+    std::string unix_dgram_path;
 
     // [SEQUENCE: CPP-MVP4-21]
     // 커맨드 라인 인자 파싱
     int opt;
-    while ((opt = getopt(argc, argv, "p:d:s:iI:Ph")) != -1) {
+    while ((opt = getopt(argc, argv, "p:d:s:iI:r:b:B:u:U:D:o:R:M:x:Q:T:t:Ph")) != -1) {
         switch (opt) {
             case 'p': port = std::stoi(optarg); break;
             case 'P': persist_config.enabled = true; break;
@@ -39,8 +62,59 @@ int main(int argc, char* argv[]) {
                 irc_enabled = true;
                 irc_port = std::stoi(optarg);
                 break;
+            // [SEQUENCE: CPP-MVP7-45]
+            case 'r': reactor_count = std::stoul(optarg); break;
+            // [SEQUENCE: CPP-MVP7-78]
+            case 'b':
+                if (std::string(optarg) == "io_uring") {
+                    io_backend = Reactor::Backend::IO_URING;
+                } else if (std::string(optarg) != "epoll") {
+                    std::cerr << "Unknown I/O backend: " << optarg << " (use epoll or io_uring)" << std::endl;
+                    return 1;
+                }
+                break;
+            // [SEQUENCE: CPP-MVP7-181]
+            case 'o':
+                if (!LogBuffer::parsePolicy(optarg, overflow_policy)) {
+                    std::cerr << "Unknown overflow policy: " << optarg
+                              << " (use drop-oldest, drop-newest, block or level-aware)" << std::endl;
+                    return 1;
+                }
+                break;
+            // [SEQUENCE: CPP-MVP7-267]
+            case 'M': buffer_budget = std::stoul(optarg) * 1024 * 1024; break;
+            // [SEQUENCE: CPP-MVP7-338]
+            case 'x':
+                if (!LogBuffer::parseIndexMode(optarg, index_mode)) {
+                    std::cerr << "Unknown index mode: " << optarg << " (use full or bloom)" << std::endl;
+                    return 1;
+                }
+                break;
+            // [SEQUENCE: CPP-MVP7-356]
+            case 'Q': query_threads = std::stoul(optarg); break;
+            // [SEQUENCE: CPP-MVP7-288]
+            case 'T':
+                spill_config.enabled = true;
+                spill_config.diskBudget = std::stoul(optarg) * 1024 * 1024;
+                break;
+            case 't': spill_config.directory = optarg; break;
+            // [SEQUENCE: CPP-MVP7-204]
+            case 'R':
+                if (!RateLimitConfig::parse(optarg, rate_limit)) {
+                    std::cerr << "Invalid rate limit: " << optarg
+                              << " (use conn=N,source=N,burst=N,action=drop|sample|delay,sample=N)" << std::endl;
+                    return 1;
+                }
+                break;
+            // [SEQUENCE: CPP-MVP7-156]
+            case 'B': binary_port = std::stoi(optarg); break;
+            // [SEQUENCE: CPP-MVP7-125]
+            case 'u': syslog_port = std::stoi(optarg); break;
+            // [SEQUENCE: CPP-MVP7-137]
+            case 'U': unix_stream_path = optarg; break;
+            case 'D': unix_dgram_path = optarg; break;
             case 'h':
-                std::cout << "Usage: " << argv[0] << " [-p port] [-P] [-d dir] [-s size_mb] [-i] [-I irc_port] [-h]" << std::endl;
+                std::cout << "Usage: " << argv[0] << " [-p port] [-P] [-d dir] [-s size_mb] [-i] [-I irc_port] [-r reactors] [-b epoll|io_uring] [-B binary_port] [-u syslog_udp_port] [-U unix_stream_path] [-D unix_dgram_path] [-o drop-oldest|drop-newest|block|level-aware] [-M buffer_mb] [-x full|bloom] [-Q query_threads] [-T spill_mb] [-t spill_dir] [-R conn=N,source=N,burst=N,action=drop|sample|delay] [-h]" << std::endl;
                 return 0;
         }
     }
@@ -50,6 +124,17 @@ int main(int argc, char* argv[]) {
 
     try {
         g_logServer = std::make_unique<LogServer>(port);
+        g_logServer->setReactorCount(reactor_count);
+        g_logServer->setIoBackend(io_backend);
+        g_logServer->setOverflowPolicy(overflow_policy);
+        g_logServer->setBufferBudget(buffer_budget);
+        g_logServer->setIndexMode(index_mode);
+        g_logServer->setQueryThreads(query_threads);
+        g_logServer->setSpillConfig(spill_config);
+        g_logServer->setRateLimit(rate_limit);
+        g_logServer->setBinaryPort(binary_port);
+        g_logServer->setSyslogPort(syslog_port);
+        g_logServer->setUnixSocketPaths(unix_stream_path, unix_dgram_path);
 
         // [SEQUENCE: CPP-MVP4-22]
         // 영속성 관리자 생성 및 주입
@@ -0,0 +1,210 @@
+// [SEQUENCE: CPP-MVP7-396]
+// KeywordAutomaton 차등 테스트. 자동자와 ParsedQuery::matchesText의 AND/OR 결과를 키워드마다
+// SubstringSearch::contains로 찾는 기준 루프와 비교한다. 접미사/겹치는 키워드, 중복, 빈 키워드,
+// 찾은 키워드 비트가 힙으로 가는 256개 초과, 루트 건너뛰기 유무, 자동자를 쓰는 키워드 수 경계를 다룬다.
+#include "KeywordAutomaton.h"
+#include "QueryParser.h"
+#include "SubstringSearch.h"
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+size_t failures = 0;
+size_t cases = 0;
+
+std::string joined(const std::vector<std::string>& keywords) {
+    std::string out;
+    for (const auto& keyword : keywords) {
+        if (!out.empty()) out.push_back(',');
+        out += keyword;
+    }
+    return out;
+}
+
+void report(const char* what, const std::vector<std::string>& keywords, const std::string& text, bool all,
+            bool expected) {
+    if (++failures > 10) return;
+    std::string shown = keywords.size() > 8 ? std::to_string(keywords.size()) + " keywords" : joined(keywords);
+    std::string body = text.size() > 80 ? text.substr(0, 80) + "...(" + std::to_string(text.size()) + " bytes)" : text;
+    std::cerr << "FAIL " << what << (all ? " AND" : " OR") << ": keywords=[" << shown << "] text=\"" << body
+              << "\" expected=" << expected << "\n";
+}
+
+// 자동자 도입 전의 키워드별 검사
+bool reference(const std::vector<std::string>& keywords, std::string_view text, bool all) {
+    for (const auto& keyword : keywords) {
+        if (SubstringSearch::contains(text, keyword) != all) return !all;
+    }
+    return all;
+}
+
+void check(const KeywordAutomaton& automaton, const std::vector<std::string>& keywords, const std::string& text) {
+    for (bool all : {true, false}) {
+        ++cases;
+        bool expected = reference(keywords, text, all);
+        if (automaton.matches(text, all) != expected) report("automaton", keywords, text, all, expected);
+    }
+}
+
+void checkAll(const std::vector<std::string>& keywords, const std::vector<std::string>& texts) {
+    KeywordAutomaton automaton(keywords);
+    for (const auto& text : texts) check(automaton, keywords, text);
+}
+
+void expectCount(const std::vector<std::string>& keywords, size_t expected) {
+    ++cases;
+    size_t got = KeywordAutomaton(keywords).keywordCount();
+    if (got == expected) return;
+    ++failures;
+    std::cerr << "FAIL keywordCount: keywords=[" << joined(keywords) << "] expected=" << expected << " got=" << got
+              << "\n";
+}
+
+// 한 키워드가 다른 키워드의 접미사/접두사이거나 서로 겹치는 경우 (실패 링크로 물려받는 출력)
+void testOverlapping() {
+    std::vector<std::string> keywords{"he", "she", "his", "hers"};
+    checkAll(keywords, {"", "h", "he", "she", "ushers", "hishers", "ahishe", "hxsxhxe", "sh", "shhe", "hhhers",
+                        "ushe", "rs hers", "his", "xhixs"});
+    checkAll({"a", "aa", "aaa", "aaaa"}, {"", "a", "aa", "aaa", "aaaa", "baaab", "ab", "aba"});
+    checkAll({"abcd", "bc", "c", "bcx"}, {"abcd", "abcx", "bcd", "xbcx", "ab", "d"});
+    checkAll({"abab", "bab", "ba"}, {"aba", "abab", "bab", "ababab", "abba"});
+}
+
+// 같은 키워드는 하나로 세고, 빈 키워드는 언제나 나온 것으로 봄
+void testDuplicatesAndEmpty() {
+    expectCount({"abc", "abc", "x"}, 2);
+    expectCount({"", "", "y"}, 2);
+    checkAll({"abc", "abc", "x"}, {"abc", "x", "abcx", "xab", ""});
+    checkAll({"", "foo"}, {"", "fo", "foo", "barfoo"});
+    checkAll({""}, {"", "anything"});
+    checkAll({"", ""}, {"", "z"});
+    checkAll({"dup", "", "dup", "other"}, {"dup", "other", "dup other", ""});
+}
+
+// 첫 바이트가 MAX_ANY_BYTES개 이하면 루트에서 findAnyOf로 건너뛰고, 넘으면 바이트마다 전이.
+// 첫 바이트를 벡터 블록(16/32바이트) 경계 앞뒤와 본문 끝에 두고, 첫 바이트만 있고 키워드는 없는 본문도 봄
+void testRootSkip() {
+    std::vector<std::string> few{"kx", "qy", "zzz"};
+    std::vector<std::string> many;
+    for (size_t i = 0; i <= SubstringSearch::MAX_ANY_BYTES; ++i) many.push_back(std::string(1, char('A' + i)) + "#!");
+    for (const auto& keywords : {few, many}) {
+        KeywordAutomaton automaton(keywords);
+        for (size_t size = 0; size <= 80; ++size) {
+            std::string base(size, '.');
+            check(automaton, keywords, base);
+            for (size_t at = 0; at < size; ++at) {
+                for (const auto& keyword : keywords) {
+                    std::string planted = base;
+                    planted.replace(at, std::min(keyword.size(), size - at), keyword.substr(0, size - at));
+                    check(automaton, keywords, planted);
+                    // 첫 바이트만 있고 나머지가 다름 (루트로 되돌아와 다시 건너뛰어야 함)
+                    planted = base;
+                    planted[at] = keyword[0];
+                    check(automaton, keywords, planted);
+                }
+            }
+        }
+        // 모든 키워드를 멀리 떨어뜨려 AND가 본문 끝까지 건너뛰며 모두 모으는지
+        std::string spread;
+        for (const auto& keyword : keywords) spread += std::string(37, '.') + keyword;
+        check(automaton, keywords, spread);
+        check(automaton, keywords, spread.substr(0, spread.size() - 1));
+    }
+}
+
+// 찾은 키워드 비트: 64개 단어 경계와 INLINE_WORDS(256개)를 넘는 힙 비트셋.
+// 키워드를 하나씩 빼 본 본문으로 AND가 빠진 키워드를 정확히 가려내는지 확인
+void testBitset() {
+    for (size_t count : {63, 64, 65, 128, 255, 256, 257, 300, 600}) {
+        std::vector<std::string> keywords;
+        for (size_t i = 0; i < count; ++i) keywords.push_back("k" + std::to_string(i) + ";");
+        KeywordAutomaton automaton(keywords);
+        expectCount(keywords, count);
+        std::string everything;
+        for (const auto& keyword : keywords) everything += keyword + " ";
+        check(automaton, keywords, everything);
+        for (size_t missing : {size_t(0), size_t(63), size_t(64), count / 2, count - 1}) {
+            if (missing >= count) continue;
+            std::string text;
+            for (size_t i = 0; i < count; ++i) {
+                if (i != missing) text += keywords[i] + " ";
+            }
+            check(automaton, keywords, text);
+        }
+        // 같은 키워드만 반복되면 비트가 한 번만 세어져야 함
+        std::string repeated;
+        for (size_t i = 0; i < count; ++i) repeated += keywords[0];
+        check(automaton, keywords, repeated);
+    }
+}
+
+// 작은 알파벳의 무작위 키워드/본문 (0x80 이상 바이트 포함)
+void testRandom() {
+    std::mt19937 rng(2025);
+    for (int round = 0; round < 20000; ++round) {
+        size_t alphabet = 2 + rng() % 5;
+        auto random = [&](size_t length) {
+            std::string s(length, ' ');
+            for (auto& c : s) c = rng() % 50 == 0 ? static_cast<char>(0x80 + rng() % 3) : static_cast<char>('a' + rng() % alphabet);
+            return s;
+        };
+        size_t count = 1 + rng() % (round % 10 == 0 ? 300 : 12);
+        std::vector<std::string> keywords;
+        for (size_t i = 0; i < count; ++i) keywords.push_back(random(rng() % 8 == 0 ? 0 : 1 + rng() % 5));
+        if (count > 1 && rng() % 4 == 0) keywords[1] = keywords[0];
+        KeywordAutomaton automaton(keywords);
+        for (int t = 0; t < 4; ++t) {
+            std::string text = random(rng() % 70);
+            if (rng() % 2) {
+                for (const auto& keyword : keywords) {
+                    if (rng() % 2) text += keyword;
+                }
+            }
+            check(automaton, keywords, text);
+        }
+    }
+}
+
+// ParsedQuery::matchesText: KEYWORD_AUTOMATON_MIN 앞뒤 키워드 수에서 기준 루프와 같은지.
+// AND는 첫 키워드를 먼저 보므로 첫 키워드만 빠진 본문, 첫 키워드만 있는 본문, 첫 키워드가 맨 끝인 본문을 넣음
+void testParsedQuery() {
+    for (size_t count = ParsedQuery::KEYWORD_AUTOMATON_MIN - 2; count <= ParsedQuery::KEYWORD_AUTOMATON_MIN + 2;
+         ++count) {
+        std::vector<std::string> keywords;
+        for (size_t i = 0; i < count; ++i) keywords.push_back("w" + std::to_string(i) + (i % 3 == 0 ? "x" : ""));
+        // 첫 키워드가 다른 키워드의 일부인 경우 (w1x 안의 w1 같은 접두사 관계)
+        keywords.push_back("w1");
+        std::string rest, all;
+        for (size_t i = 1; i < keywords.size(); ++i) rest += keywords[i] + " ";
+        all = rest + keywords[0];
+        std::vector<std::string> texts{"", keywords[0], rest, all, keywords[0] + " " + rest, "w", "w1 w2",
+                                       all.substr(0, all.size() - 1)};
+        for (const char* op : {"AND", "OR"}) {
+            auto query = QueryParser::parse("QUERY keywords=" + joined(keywords) + " operator=" + op);
+            bool isAnd = std::string(op) == "AND";
+            for (const auto& text : texts) {
+                ++cases;
+                bool expected = reference(keywords, text, isAnd);
+                if (query->matchesText(text) != expected) report("matchesText", keywords, text, isAnd, expected);
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    testOverlapping();
+    testDuplicatesAndEmpty();
+    testRootSkip();
+    testBitset();
+    testRandom();
+    testParsedQuery();
+    std::cout << "cases=" << cases << " failures=" << failures << "\n";
+    if (failures != 0) return 1;
+    std::cout << "All keyword automaton tests passed!\n";
+    return 0;
+}
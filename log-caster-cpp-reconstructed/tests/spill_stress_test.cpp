@@ -0,0 +1,178 @@
+// [SEQUENCE: CPP-MVP7-397]
+// 디스크 계층을 켠 LogBuffer의 동시 수집/검색 스트레스 테스트. 작은 샤드 두 개에 생산자 스레드가 하나씩
+// 계속 넣어 항목이 밀려나거나(DROP_OLDEST, BLOCK) 중간에서 빠지는(LEVEL_AWARE) 동안, 검색 스레드들이
+// 링과 세그먼트를 함께 훑는다. 링에서 떠난 항목은 모두 세그먼트에 있으므로 검색 결과는
+//  - 같은 항목을 두 번 담지 않고 (SegmentStore::missedBy가 링에서 이미 읽은 항목을 뺌)
+//  - 검색 시작 전에 들어가 끝까지 남은 항목을 하나도 빠뜨리지 않아야 한다 (훑는 도중 밀려난 항목 포함).
+// 끝까지 남은 항목은 생산자가 멈춘 뒤의 마지막 검색 결과로 정한다. 수집이 항목을 버리지 않는
+// DROP_OLDEST/BLOCK은 넣은 항목 전부가 그 결과여야 한다 (LEVEL_AWARE는 낮은 레벨이 없으면 새 항목을 버림).
+#include "LogBuffer.h"
+#include "SegmentStore.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+constexpr size_t PRODUCERS = 2;
+constexpr size_t SEARCHERS = 2;
+constexpr size_t SHARD_BUDGET = 256 * 1024;
+constexpr uint64_t ENTRIES_PER_PRODUCER = 60000;
+constexpr uint64_t MARKER_EVERY = 3;
+// 생산자는 이만큼 넣을 때마다 검색이 하나 더 끝나기를 기다려, 빠른 기계에서도 수집 내내 검색이 겹치게 함
+constexpr uint64_t ENTRIES_PER_SEARCH = 2000;
+const char* const LEVELS[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+
+size_t failures = 0;
+std::mutex failureMutex;
+
+void fail(const std::string& what) {
+    std::lock_guard<std::mutex> lock(failureMutex);
+    if (++failures <= 10) std::cerr << "FAIL " << what << "\n";
+}
+
+// "p<생산자> n<번호> marker ..." 형식의 번호를 생산자별 한 줄로 펼친 키
+uint64_t keyOf(const std::string& line) {
+    size_t at = line.find("] p");
+    if (at == std::string::npos) return UINT64_MAX;
+    uint64_t producer = std::stoull(line.substr(at + 3));
+    size_t n = line.find(" n", at);
+    return producer * ENTRIES_PER_PRODUCER + std::stoull(line.substr(n + 2));
+}
+
+std::vector<uint64_t> keysOf(const std::vector<std::string>& lines) {
+    std::vector<uint64_t> keys;
+    keys.reserve(lines.size());
+    for (const auto& line : lines) keys.push_back(keyOf(line));
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+// 검색 하나의 결과와 그 검색 시작 전에 생산자가 넣기를 마친 항목 수
+struct Observation {
+    std::vector<uint64_t> keys;
+    uint64_t done[PRODUCERS];
+};
+
+void run(LogBuffer::OverflowPolicy policy) {
+    const std::string name = LogBuffer::policyName(policy);
+    std::filesystem::path dir = std::filesystem::temp_directory_path() /
+                                ("logcaster-spill-stress-" + std::to_string(getpid()) + "-" + name);
+    std::filesystem::remove_all(dir);
+
+    LogBuffer buffer(SHARD_BUDGET * PRODUCERS, PRODUCERS);
+    buffer.setOverflowPolicy(policy);
+    SegmentStoreConfig config;
+    config.enabled = true;
+    config.directory = dir;
+    config.diskBudget = 256 * 1024 * 1024;
+    config.segmentBytes = 1024 * 1024;
+    auto store = std::make_shared<SegmentStore>(config);
+    buffer.setSpillStore(store);
+
+    std::atomic<uint64_t> done[PRODUCERS];
+    for (auto& d : done) d.store(0);
+    std::atomic<size_t> running{PRODUCERS};
+    std::atomic<uint64_t> searches{0};
+
+    // 레벨은 넣는 동안 DEBUG에서 ERROR로 오르며 각 단계에 한 단계 낮은 항목이 섞임. LEVEL_AWARE는
+    // 낮은 레벨이 다 빠지면 새 항목을 버리므로, 단계가 오를 때마다 섞여 있던 낮은 항목이 링 중간에서 빠짐
+    auto levelOf = [](uint64_t n) {
+        uint64_t stage = n * 4 / ENTRIES_PER_PRODUCER;
+        return LEVELS[stage == 0 ? 0 : stage - (n * 7 + n / 5) % 2];
+    };
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p] {
+            uint64_t n = 0;
+            while (n < ENTRIES_PER_PRODUCER) {
+                std::vector<LogEntry> batch;
+                uint64_t size = std::min<uint64_t>(1 + n % 13, ENTRIES_PER_PRODUCER - n);
+                for (uint64_t i = 0; i < size; ++i, ++n) {
+                    std::string message = "p" + std::to_string(p) + " n" + std::to_string(n) +
+                                          (n % MARKER_EVERY == 0 ? " marker" : " filler") + " payload";
+                    batch.emplace_back(std::move(message), levelOf(n), "stress");
+                }
+                buffer.pushBatch(batch, p);
+                done[p].store(n, std::memory_order_release);
+                while (searches.load() < n / ENTRIES_PER_SEARCH) std::this_thread::yield();
+            }
+            running--;
+        });
+    }
+
+    std::vector<Observation> observations;
+    std::mutex observationMutex;
+    std::vector<std::thread> searchers;
+    for (size_t s = 0; s < SEARCHERS; ++s) {
+        searchers.emplace_back([&] {
+            while (running.load() > 0) {
+                Observation observation;
+                for (size_t p = 0; p < PRODUCERS; ++p) observation.done[p] = done[p].load(std::memory_order_acquire);
+                observation.keys = keysOf(buffer.search("marker"));
+                std::lock_guard<std::mutex> lock(observationMutex);
+                observations.push_back(std::move(observation));
+                searches++;
+            }
+        });
+    }
+    for (auto& t : producers) t.join();
+    for (auto& t : searchers) t.join();
+
+    std::vector<uint64_t> survivors = keysOf(buffer.search("marker"));
+    auto stats = buffer.getStats();
+    auto spill = store->stats();
+    if (spill.discardedLogs != 0) fail(name + ": spill discarded " + std::to_string(spill.discardedLogs) + " entries");
+    if (std::adjacent_find(survivors.begin(), survivors.end()) != survivors.end()) fail(name + ": final result has duplicates");
+    if (policy != LogBuffer::OverflowPolicy::LEVEL_AWARE) {
+        uint64_t markers = PRODUCERS * ((ENTRIES_PER_PRODUCER + MARKER_EVERY - 1) / MARKER_EVERY);
+        if (survivors.size() != markers) {
+            fail(name + ": final result has " + std::to_string(survivors.size()) + " markers, pushed " +
+                 std::to_string(markers));
+        }
+    } else if (spill.spilledLogs < 1000) {
+        fail(name + ": only " + std::to_string(spill.spilledLogs) + " entries were shed into the spill");
+    }
+
+    size_t duplicates = 0, gaps = 0, unknown = 0;
+    for (const auto& observation : observations) {
+        const auto& keys = observation.keys;
+        if (std::adjacent_find(keys.begin(), keys.end()) != keys.end()) duplicates++;
+        // 결과의 모든 항목은 끝까지 남은 항목이어야 하고 (버려진 항목이 보이면 안 됨)
+        if (!std::includes(survivors.begin(), survivors.end(), keys.begin(), keys.end())) unknown++;
+        // 검색 시작 전에 넣기를 마친 생존 항목은 모두 결과에 있어야 함
+        for (uint64_t key : survivors) {
+            uint64_t producer = key / ENTRIES_PER_PRODUCER;
+            if (key % ENTRIES_PER_PRODUCER >= observation.done[producer]) continue;
+            if (!std::binary_search(keys.begin(), keys.end(), key)) {
+                gaps++;
+                break;
+            }
+        }
+    }
+    if (duplicates) fail(name + ": " + std::to_string(duplicates) + " searches returned duplicates");
+    if (gaps) fail(name + ": " + std::to_string(gaps) + " searches missed entries");
+    if (unknown) fail(name + ": " + std::to_string(unknown) + " searches returned dropped entries");
+
+    std::cout << "policy=" << name << " searches=" << observations.size() << " spilled=" << spill.spilledLogs
+              << " shed=" << stats.shedLogs << " markers=" << survivors.size() << "\n";
+    std::filesystem::remove_all(dir);
+}
+
+} // namespace
+
+int main() {
+    run(LogBuffer::OverflowPolicy::DROP_OLDEST);
+    run(LogBuffer::OverflowPolicy::BLOCK);
+    run(LogBuffer::OverflowPolicy::LEVEL_AWARE);
+    if (failures != 0) return 1;
+    std::cout << "All spill stress tests passed!\n";
+    return 0;
+}
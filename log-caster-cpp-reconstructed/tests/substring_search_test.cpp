@@ -0,0 +1,156 @@
+// [SEQUENCE: CPP-MVP7-379]
+// SubstringSearch 커널 차등 테스트. 커널 함수들이 익명 네임스페이스에 있어 소스를 직접 포함하고,
+// 스칼라/SSE2/AVX2 커널과 공개 함수를 std::string_view::find, find_first_of 결과와 비교한다.
+// 본문은 정확한 크기로 힙에 잡아 ASan 빌드에서 블록 경계 밖 읽기가 드러나게 한다.
+#include "../src/SubstringSearch.cpp"
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct NamedKernel {
+    const char* name;
+    Kernel kernel;
+};
+
+std::vector<NamedKernel> findKernels() {
+    std::vector<NamedKernel> kernels{{"scalar", findScalar}};
+#ifdef SUBSTRING_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2")) kernels.push_back({"sse2", findSse2});
+    if (__builtin_cpu_supports("avx2")) kernels.push_back({"avx2", findAvx2});
+#endif
+    return kernels;
+}
+
+std::vector<NamedKernel> anyKernels() {
+    std::vector<NamedKernel> kernels{{"scalar", findAnyScalar}};
+#ifdef SUBSTRING_SEARCH_X86
+    if (__builtin_cpu_supports("sse2")) kernels.push_back({"sse2", findAnySse2});
+    if (__builtin_cpu_supports("avx2")) kernels.push_back({"avx2", findAnyAvx2});
+#endif
+    return kernels;
+}
+
+size_t failures = 0;
+size_t cases = 0;
+
+void report(const char* kernel, const std::string& haystack, const std::string& needle, size_t expected, size_t got) {
+    if (++failures > 10) return;
+    std::cerr << "FAIL " << kernel << ": size=" << haystack.size() << " needle=\"" << needle
+              << "\" expected=" << expected << " got=" << got << "\n";
+}
+
+// 본문을 정확한 크기의 버퍼로 옮겨 모든 커널과 공개 함수를 기준 결과와 비교
+void checkFind(const std::vector<NamedKernel>& kernels, const std::string& haystack, const std::string& needle) {
+    ++cases;
+    std::unique_ptr<char[]> exact(new char[haystack.size() + 1]);
+    std::memcpy(exact.get(), haystack.data(), haystack.size());
+    std::string_view text(exact.get(), haystack.size());
+    size_t expected = text.find(needle);
+
+    size_t got = SubstringSearch::find(text, needle);
+    if (got != expected) report("find", haystack, needle, expected, got);
+    if (needle.empty() || needle.size() > haystack.size()) return;
+    for (const auto& k : kernels) {
+        got = k.kernel(text.data(), text.size(), needle.data(), needle.size());
+        if (got != expected) report(k.name, haystack, needle, expected, got);
+    }
+}
+
+void checkFindAnyOf(const std::vector<NamedKernel>& kernels, const std::string& haystack, const std::string& bytes) {
+    ++cases;
+    std::unique_ptr<char[]> exact(new char[haystack.size() + 1]);
+    std::memcpy(exact.get(), haystack.data(), haystack.size());
+    std::string_view text(exact.get(), haystack.size());
+    size_t expected = bytes.empty() ? std::string_view::npos : text.find_first_of(bytes);
+
+    size_t got = SubstringSearch::findAnyOf(text, bytes);
+    if (got != expected) report("findAnyOf", haystack, bytes, expected, got);
+    if (bytes.empty()) return;
+    for (const auto& k : kernels) {
+        if (k.kernel != findAnyScalar && bytes.size() > SubstringSearch::MAX_ANY_BYTES) continue;
+        got = k.kernel(text.data(), text.size(), bytes.data(), bytes.size());
+        if (got != expected) report(k.name, haystack, bytes, expected, got);
+    }
+}
+
+// needle의 첫/끝 바이트를 섞은 잡음이라 첫/끝만 맞고 가운데가 다른 후보 자리가 많이 생김
+std::string noise(std::mt19937& rng, size_t size, const std::string& needle) {
+    const char pool[] = {needle.front(), needle.back(), needle[needle.size() / 2], 'x'};
+    std::string text(size, ' ');
+    for (auto& c : text) c = pool[rng() % 4];
+    return text;
+}
+
+// needle 길이 1..64, 본문 길이는 needle 길이부터 블록 두 개 남짓까지. needle을 맨 앞, 맨 끝,
+// 그리고 겹쳐 읽는 마지막 블록(AVX2 32바이트)에 걸치는 모든 자리에 심어 확인
+void testFind() {
+    auto kernels = findKernels();
+    std::mt19937 rng(2024);
+    for (size_t n = 1; n <= 64; ++n) {
+        std::string needle(n, ' ');
+        for (auto& c : needle) c = static_cast<char>('a' + rng() % 3);
+        for (size_t size = n; size <= n + 80; ++size) {
+            std::string base = noise(rng, size, needle);
+            checkFind(kernels, base, needle);
+
+            size_t last = size - n;
+            size_t from = last > 40 ? last - 40 : 0;
+            for (size_t at = from; at <= last; ++at) {
+                std::string planted = base;
+                planted.replace(at, n, needle);
+                checkFind(kernels, planted, needle);
+            }
+            if (from > 0) {
+                std::string planted = base;
+                planted.replace(0, n, needle);
+                checkFind(kernels, planted, needle);
+            }
+        }
+    }
+    // 경계 조건: 빈 needle, 빈 본문, 본문보다 긴 needle
+    checkFind(kernels, "", "");
+    checkFind(kernels, "abc", "");
+    checkFind(kernels, "", "a");
+    checkFind(kernels, "ab", "abc");
+}
+
+// 집합 크기 1..12 (벡터 커널 상한 MAX_ANY_BYTES 앞뒤), 찾는 바이트를 맨 앞/맨 끝/마지막 블록에 둠
+void testFindAnyOf() {
+    auto kernels = anyKernels();
+    std::mt19937 rng(7);
+    for (size_t count = 0; count <= 12; ++count) {
+        std::string bytes;
+        for (size_t i = 0; i < count; ++i) bytes.push_back(static_cast<char>('A' + i * 2));
+        for (size_t size = 0; size <= 100; ++size) {
+            std::string base(size, ' ');
+            for (auto& c : base) c = static_cast<char>('a' + rng() % 26);
+            checkFindAnyOf(kernels, base, bytes);
+            if (count == 0 || size == 0) continue;
+            size_t from = size > 40 ? size - 40 : 0;
+            for (size_t at = from; at < size; ++at) {
+                std::string planted = base;
+                planted[at] = bytes[rng() % count];
+                checkFindAnyOf(kernels, planted, bytes);
+            }
+            std::string planted = base;
+            planted[0] = bytes[rng() % count];
+            checkFindAnyOf(kernels, planted, bytes);
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    testFind();
+    testFindAnyOf();
+    std::cout << "kernel=" << SubstringSearch::kernelName() << " cases=" << cases << " failures=" << failures << "\n";
+    if (failures != 0) return 1;
+    std::cout << "All substring search tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+# Integration test for the length-prefixed binary ingest protocol (-B port).
+#   frame  := u32 length | body[length]
+#   DEFINE := u8 type=1 | u16 id | u16 len | bytes[len]
+#   LOG    := u8 type=2 | u8 level | u8 metaCount | u8 reserved
+#             | u16 sourceId | u16 categoryId | u64 timestampMicros | meta... | payload
+import os
+import socket
+import struct
+import subprocess
+import time
+
+HOST = '127.0.0.1'
+QUERY_PORT = 9998
+BINARY_PORT = 9997
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SERVER_EXEC = os.environ.get("LOGCASTER_SERVER", os.path.join(SCRIPT_DIR, "../build/logcaster-cpp"))
+
+DEBUG, INFO, WARN, ERROR = 0, 1, 2, 3
+
+def frame(body):
+    return struct.pack('!I', len(body)) + body
+
+def define(string_id, value):
+    data = value.encode()
+    return frame(struct.pack('!BHH', 1, string_id, len(data)) + data)
+
+def log(message, level=INFO, source_id=0, category_id=0, timestamp_us=0):
+    return frame(struct.pack('!BBBBHHQ', 2, level, 0, 0, source_id, category_id, timestamp_us) + message.encode())
+
+def connect():
+    s = socket.create_connection((HOST, BINARY_PORT))
+    s.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    return s
+
+def query(q):
+    with socket.create_connection((HOST, QUERY_PORT)) as s:
+        s.sendall((q + '\n').encode())
+        chunks = []
+        while True:
+            data = s.recv(65536)
+            if not data:
+                break
+            chunks.append(data)
+    return b''.join(chunks).decode()
+
+def messages(q):
+    # Return the message bodies after "FOUND: N matches", without the "[time] " prefix
+    lines = query(q).splitlines()
+    assert lines and lines[0].startswith("FOUND:"), lines
+    return [line.split('] ', 1)[1] for line in lines[1:]]
+
+def wait_closed(s, timeout=3.0):
+    # A server-side close shows up as b'' or ECONNRESET
+    s.settimeout(timeout)
+    try:
+        return s.recv(1) == b''
+    except ConnectionResetError:
+        return True
+    except socket.timeout:
+        return False
+
+def settle():
+    time.sleep(0.3)
+
+def test_define_then_log():
+    print("--- Test 1: DEFINE followed by LOG frames ---")
+    with connect() as s:
+        s.sendall(define(1, "svc-alpha") + define(2, "auth")
+                  + log("bin define one", ERROR, 1, 2)
+                  + log("bin define two", WARN, 1, 0)
+                  + log("bin define three", INFO, 0, 2))
+        settle()
+    assert messages("QUERY keywords=bin,define") == ["bin define one", "bin define two", "bin define three"]
+    assert messages("QUERY source=svc-alpha") == ["bin define one", "bin define two"]
+    assert messages("QUERY category=auth") == ["bin define one", "bin define three"]
+    assert messages("QUERY keywords=bin,define level=ERROR") == ["bin define one"]
+    assert messages("QUERY keywords=bin,define level=WARN") == ["bin define two"]
+    print("OK\n")
+
+def test_split_frame():
+    print("--- Test 2: Frame split across two sends ---")
+    with connect() as s:
+        # Split DEFINE+LOG inside the length prefix, then a LOG inside its body
+        first = define(7, "svc-split") + log("bin split payload", WARN, 7)
+        second = log("bin split again", ERROR, 7)
+        for data, cut in ((first, 2), (second, len(second) - 5)):
+            s.sendall(data[:cut])
+            time.sleep(0.2)
+            s.sendall(data[cut:])
+            time.sleep(0.2)
+        settle()
+        s.sendall(log("bin split alive", INFO, 7))
+        settle()
+        assert not wait_closed(s, 0.2), "valid split frames must not close the connection"
+    assert messages("QUERY source=svc-split") == ["bin split payload", "bin split again", "bin split alive"]
+    print("OK\n")
+
+def test_invalid_length_closes():
+    print("--- Test 3: Oversized and zero-length frames close the connection ---")
+    for name, header in (("oversized", struct.pack('!I', 64 * 1024 + 1)), ("zero-length", struct.pack('!I', 0))):
+        with connect() as s:
+            s.sendall(log("bin before " + name))
+            s.sendall(header + b'\x02' * 16)
+            assert wait_closed(s), name + " frame should close the connection"
+        settle()
+        assert messages("QUERY keywords=bin,before," + name) == ["bin before " + name]
+    print("OK\n")
+
+def test_undefined_source_closes():
+    print("--- Test 4: LOG with an undefined source id closes the connection ---")
+    with connect() as s:
+        s.sendall(define(3, "svc-known") + log("bin undefined ok", INFO, 3))
+        settle()
+        s.sendall(log("bin undefined bad", INFO, 42))
+        assert wait_closed(s), "undefined source id should close the connection"
+    settle()
+    assert messages("QUERY keywords=bin,undefined") == ["bin undefined ok"]
+    print("OK\n")
+
+def test_line_breaks_flattened():
+    print("--- Test 5: CR/LF in a LOG payload stays on one line ---")
+    with connect() as s:
+        s.sendall(log("bin multi\nline\r\npayload\rend", ERROR)
+                  + log("bin inject\r\nPRIVMSG #logs-all :spoofed", ERROR))
+        settle()
+    response = query("QUERY keywords=bin,multi")
+    assert response.splitlines()[0] == "FOUND: 1 matches" and len(response.splitlines()) == 2, response
+    assert messages("QUERY keywords=bin,multi") == ["bin multi line payload end"]
+    assert messages("QUERY keywords=bin,inject") == ["bin inject PRIVMSG #logs-all :spoofed"]
+    print("OK\n")
+
+if __name__ == "__main__":
+    server_proc = subprocess.Popen([SERVER_EXEC, "-B", str(BINARY_PORT)], stdout=subprocess.DEVNULL)
+    time.sleep(1)
+    try:
+        test_define_then_log()
+        test_split_frame()
+        test_invalid_length_closes()
+        test_undefined_source_closes()
+        test_line_breaks_flattened()
+    finally:
+        server_proc.terminate()
+        server_proc.wait()
+    print("All binary protocol tests passed!")
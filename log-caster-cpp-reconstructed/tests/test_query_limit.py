@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+# Integration test for limit= on a sharded buffer with the partitioned query scan.
+# Bulk entries arrive on the binary port (reactor shard) with explicit, older
+# timestamps; a few newer entries arrive over UDP syslog (its own shard). The
+# reactor shard holds more than PARALLEL_MIN_ENTRIES (16K), so with -Q 4 its scan
+# is split across query threads and stops once the newest ranges fill the limit.
+# limit=N must return exactly the N newest matches, oldest first.
+import os
+import socket
+import struct
+import subprocess
+import time
+
+HOST = '127.0.0.1'
+QUERY_PORT = 9998
+BINARY_PORT = 9997
+SYSLOG_PORT = 5514
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SERVER_EXEC = os.environ.get("LOGCASTER_SERVER", os.path.join(SCRIPT_DIR, "../build/logcaster-cpp"))
+
+BULK = 40000
+LATE = 6
+LEVELS = ["DEBUG", "INFO", "WARN", "ERROR"]
+
+def log_frame(message, level, timestamp_us):
+    body = struct.pack('!BBBBHHQ', 2, level, 0, 0, 0, 0, timestamp_us) + message.encode()
+    return struct.pack('!I', len(body)) + body
+
+def query(q):
+    with socket.create_connection((HOST, QUERY_PORT)) as s:
+        s.sendall((q + '\n').encode())
+        chunks = []
+        while True:
+            data = s.recv(65536)
+            if not data:
+                break
+            chunks.append(data)
+    return b''.join(chunks).decode()
+
+def messages(q):
+    # Return the message bodies after "FOUND: N matches", without the "[time] " prefix
+    lines = query(q).splitlines()
+    assert lines and lines[0].startswith("FOUND:"), lines
+    assert lines[0] == f"FOUND: {len(lines) - 1} matches", lines[0]
+    return [line.split('] ', 1)[1] for line in lines[1:]]
+
+def wait_for_count(expected, timeout=10.0):
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        if query("COUNT").strip() == f"COUNT: {expected}":
+            return
+        time.sleep(0.1)
+    raise AssertionError("buffer never reached " + str(expected) + " entries: " + query("COUNT").strip())
+
+def fill():
+    # Returns every entry as (message, level) in timestamp order
+    entries = []
+    base_us = int((time.time() - 3600) * 1_000_000)
+    frames = []
+    for i in range(BULK):
+        level = i % 4
+        message = f"bulk {i:05d} {'signal' if i % 7 == 0 else 'noise'}"
+        frames.append(log_frame(message, level, base_us + i * 1000))
+        entries.append((message, LEVELS[level]))
+    with socket.create_connection((HOST, BINARY_PORT)) as s:
+        s.sendall(b''.join(frames))
+
+    # Syslog entries take their receive time, so they are newer than every bulk entry
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as s:
+        for j in range(LATE):
+            pri, level = (11, "ERROR") if j % 2 == 0 else (14, "INFO")
+            message = f"late {j} signal"
+            s.sendto(f"<{pri}>{message}".encode(), (HOST, SYSLOG_PORT))
+            entries.append((message, level))
+            time.sleep(0.01)
+    wait_for_count(BULK + LATE)
+    return entries
+
+def check(entries, description, q, keyword=None, level=None, limit=None):
+    print(f"--- {description} ---")
+    print(f"> {q}")
+    matched = [m for m, lv in entries if (keyword is None or keyword in m) and (level is None or lv == level)]
+    expected = matched[-limit:] if limit else matched
+    got = messages(q)
+    assert got == expected, (len(got), got[:3], expected[:3])
+    print(f"{len(got)} matches, newest: {got[-1] if got else '-'}")
+    print("OK\n")
+
+if __name__ == "__main__":
+    server_proc = subprocess.Popen([SERVER_EXEC, "-B", str(BINARY_PORT), "-u", str(SYSLOG_PORT),
+                                    "-Q", "4", "-M", "64"], stdout=subprocess.DEVNULL)
+    time.sleep(1)
+    try:
+        entries = fill()
+        # Spans both shards: the newest bulk matches, then the syslog ones
+        check(entries, "Test 1: level= with limit", "QUERY level=ERROR limit=10", level="ERROR", limit=10)
+        check(entries, "Test 2: keyword with limit", "QUERY keywords=signal limit=10", keyword="signal", limit=10)
+        check(entries, "Test 3: keyword and level with limit", "QUERY keywords=signal level=ERROR limit=25",
+              keyword="signal", level="ERROR", limit=25)
+        # Only the syslog shard contributes
+        check(entries, "Test 4: limit inside the newest shard", "QUERY keywords=late limit=2", keyword="late", limit=2)
+        # Only the partitioned bulk shard contributes, well past the newest partition
+        check(entries, "Test 5: large limit in the bulk shard", "QUERY level=DEBUG limit=5000", level="DEBUG", limit=5000)
+        # A limit above the match count returns every match
+        check(entries, "Test 6: limit above the match count", "QUERY keywords=late limit=100", keyword="late", limit=100)
+        check(entries, "Test 7: no limit", "QUERY keywords=signal level=WARN", keyword="signal", level="WARN")
+    finally:
+        server_proc.terminate()
+        server_proc.wait()
+    print("All query limit tests passed!")
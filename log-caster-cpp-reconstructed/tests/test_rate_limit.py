@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+# Integration test for ingest rate limiting (-R) and the LIMITS command.
+# With conn=1,burst=50 a connection gets a 50-line burst and then about one line
+# per second, so a fast 1000-line burst is mostly over the limit.
+import os
+import re
+import socket
+import subprocess
+import time
+
+HOST = '127.0.0.1'
+LOG_PORT = 9999
+QUERY_PORT = 9998
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SERVER_EXEC = os.environ.get("LOGCASTER_SERVER", os.path.join(SCRIPT_DIR, "../build/logcaster-cpp"))
+
+LINES = 1000
+BURST = 50
+
+def query(q):
+    with socket.create_connection((HOST, QUERY_PORT)) as s:
+        s.sendall((q + '\n').encode())
+        chunks = []
+        while True:
+            data = s.recv(65536)
+            if not data:
+                break
+            chunks.append(data)
+    return b''.join(chunks).decode()
+
+def send_burst():
+    with socket.create_connection((HOST, LOG_PORT)) as s:
+        s.sendall(''.join(f"limited line {i}\n" for i in range(LINES)).encode())
+    time.sleep(0.5)
+
+def limits():
+    response = query("LIMITS")
+    print(response.strip())
+    header = response.splitlines()[0]
+    assert header.startswith("LIMITS: "), header
+    return {k: v for k, v in re.findall(r"(\w+)=([^,\s]+)", header)}
+
+def count():
+    return int(query("COUNT").split()[1])
+
+def run_server(spec):
+    server_proc = subprocess.Popen([SERVER_EXEC, "-R", spec], stdout=subprocess.DEVNULL)
+    time.sleep(1)
+    return server_proc
+
+def stop_server(server_proc):
+    server_proc.terminate()
+    server_proc.wait()
+
+def test_drop():
+    print("--- Test 1: action=drop ---")
+    server_proc = run_server(f"conn=1,burst={BURST},action=drop")
+    try:
+        assert query("LIMITS").startswith("LIMITS: Conn=1/s, Source=0/s, Burst=50, Action=drop, Passed=0")
+        send_burst()
+        c = limits()
+        passed, dropped = int(c["Passed"]), int(c["Dropped"])
+        # The burst plus whatever refilled while the lines were arriving
+        assert BURST <= passed <= BURST + 3, passed
+        assert passed + dropped == LINES, (passed, dropped)
+        assert int(c["Sampled"]) == 0 and int(c["Delayed"]) == 0
+        assert c["Limited"] == "1"
+        assert count() == passed
+    finally:
+        stop_server(server_proc)
+    print("OK\n")
+
+def test_sample():
+    print("--- Test 2: action=sample,sample=10 ---")
+    every = 10
+    server_proc = run_server(f"conn=1,burst={BURST},action=sample,sample={every}")
+    try:
+        send_burst()
+        c = limits()
+        passed, sampled = int(c["Passed"]), int(c["Sampled"])
+        assert c["Action"] == "sample"
+        assert passed + sampled == LINES, (passed, sampled)
+        assert int(c["Dropped"]) == 0 and int(c["Delayed"]) == 0
+        # Every tenth line over the limit is kept: passed = granted + over // 10
+        granted = [g for g in range(BURST, BURST + 4) if g + (LINES - g) // every == passed]
+        assert granted, passed
+        assert count() == passed
+    finally:
+        stop_server(server_proc)
+    print("OK\n")
+
+if __name__ == "__main__":
+    test_drop()
+    test_sample()
+    print("All rate limit tests passed!")
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# Integration test for the UDP syslog listener (-u port): RFC 3164/5424 parsing
+# and recvmmsg batching. Severity maps to level, HOSTNAME to source and
+# APP-NAME/TAG to category; the sender address is the source when HOSTNAME is absent.
+import os
+import socket
+import subprocess
+import time
+
+HOST = '127.0.0.1'
+QUERY_PORT = 9998
+SYSLOG_PORT = 5514
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SERVER_EXEC = os.environ.get("LOGCASTER_SERVER", os.path.join(SCRIPT_DIR, "../build/logcaster-cpp"))
+
+def send_datagrams(datagrams):
+    with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as s:
+        for i, datagram in enumerate(datagrams):
+            s.sendto(datagram if isinstance(datagram, bytes) else datagram.encode(), (HOST, SYSLOG_PORT))
+            # Pause every 50 datagrams so the socket receive buffer never overflows
+            if i % 50 == 49:
+                time.sleep(0.05)
+    time.sleep(0.3)
+
+def query(q):
+    with socket.create_connection((HOST, QUERY_PORT)) as s:
+        s.sendall((q + '\n').encode())
+        chunks = []
+        while True:
+            data = s.recv(65536)
+            if not data:
+                break
+            chunks.append(data)
+    return b''.join(chunks).decode()
+
+def messages(q):
+    # Return the message bodies after "FOUND: N matches", without the "[time] " prefix
+    lines = query(q).splitlines()
+    assert lines and lines[0].startswith("FOUND:"), lines
+    return [line.split('] ', 1)[1] for line in lines[1:]]
+
+def test_pri_levels():
+    print("--- Test 1: PRI severity to level mapping ---")
+    # (PRI, expected level): severity = PRI & 7, facility does not matter
+    cases = [(8, "ERROR"), (11, "ERROR"), (12, "WARN"), (13, "INFO"), (14, "INFO"), (15, "DEBUG"), (165, "INFO")]
+    send_datagrams([f"<{pri}>prilevel {pri}" for pri, _ in cases])
+    for level in ("ERROR", "WARN", "INFO", "DEBUG"):
+        expected = [f"prilevel {pri}" for pri, lv in cases if lv == level]
+        got = messages(f"QUERY keywords=prilevel level={level}")
+        assert got == expected, (level, got)
+    print("OK\n")
+
+def test_missing_pri():
+    print("--- Test 2: Missing PRI defaults to user.notice ---")
+    send_datagrams(["nopri default notice"])
+    assert messages("QUERY keywords=nopri level=INFO source=127.0.0.1") == ["nopri default notice"]
+    for level in ("ERROR", "WARN", "DEBUG"):
+        assert messages(f"QUERY keywords=nopri level={level}") == []
+    print("OK\n")
+
+def test_rfc3164():
+    print("--- Test 3: RFC 3164 with and without HOSTNAME ---")
+    send_datagrams([
+        "<34>Oct 11 22:14:15 mymachine su: 'su root' failed bsdhost",
+        "<13>Oct  5 09:01:02 myapp[123]: bsd without host",
+    ])
+    assert messages("QUERY source=mymachine category=su level=ERROR") == ["'su root' failed bsdhost"]
+    assert messages("QUERY source=127.0.0.1 category=myapp level=INFO") == ["bsd without host"]
+    print("OK\n")
+
+def test_rfc5424():
+    print("--- Test 4: RFC 5424 NIL fields, escaped ']' in SD, BOM strip ---")
+    send_datagrams([
+        "<165>1 - - - - - - nil fields body",
+        '<165>1 2003-10-11T22:14:15.003Z sdhost sdapp - ID47 '
+        '[exampleSDID@32473 iut="3" note="a\\]b"][second@1 x="y"] escaped sd body',
+        b"<165>1 2003-10-11T22:14:15.003Z bomhost bomapp 42 - - \xef\xbb\xbfbom stripped body",
+    ])
+    assert messages("QUERY keywords=nil,fields source=127.0.0.1 level=INFO") == ["nil fields body"]
+    assert messages("QUERY source=sdhost category=sdapp") == ["escaped sd body"]
+    assert messages("QUERY source=bomhost category=bomapp") == ["bom stripped body"]
+    print("OK\n")
+
+def test_burst():
+    print("--- Test 5: recvmmsg burst ---")
+    count = 300
+    send_datagrams([f"<14>burst {i:04d} batched" for i in range(count)])
+    got = messages("QUERY keywords=batched")
+    assert got == [f"burst {i:04d} batched" for i in range(count)], len(got)
+    print("OK\n")
+
+def test_line_breaks_flattened():
+    print("--- Test 6: CR/LF inside MSG stays on one line ---")
+    send_datagrams([
+        "<11>first part\nsecond part\r\nthird\rend\n",
+        "<165>1 - flathost flatapp - - - multi\nline 5424",
+    ])
+    response = query("QUERY keywords=first,part")
+    assert response.splitlines()[0] == "FOUND: 1 matches" and len(response.splitlines()) == 2, response
+    assert messages("QUERY keywords=first,part") == ["first part second part third end"]
+    assert messages("QUERY source=flathost") == ["multi line 5424"]
+    print("OK\n")
+
+if __name__ == "__main__":
+    server_proc = subprocess.Popen([SERVER_EXEC, "-u", str(SYSLOG_PORT)], stdout=subprocess.DEVNULL)
+    time.sleep(1)
+    try:
+        test_pri_levels()
+        test_missing_pri()
+        test_rfc3164()
+        test_rfc5424()
+        test_burst()
+        test_line_breaks_flattened()
+    finally:
+        server_proc.terminate()
+        server_proc.wait()
+    print("All syslog tests passed!")